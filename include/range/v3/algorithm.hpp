@@ -37,9 +37,11 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/algorithm/find_if.hpp>
 #include <range/v3/algorithm/find_if_not.hpp>
 #include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/algorithm/for_each_resumable.hpp>
 #include <range/v3/algorithm/generate.hpp>
 #include <range/v3/algorithm/generate_n.hpp>
 #include <range/v3/algorithm/heap_algorithm.hpp>
+#include <range/v3/algorithm/histogram.hpp>
 #include <range/v3/algorithm/inplace_merge.hpp>
 #include <range/v3/algorithm/is_partitioned.hpp>
 #include <range/v3/algorithm/is_sorted.hpp>
@@ -82,10 +84,12 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/algorithm/set_algorithm.hpp>
 #include <range/v3/algorithm/shuffle.hpp>
 #include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/sort_resumable.hpp>
 #include <range/v3/algorithm/stable_partition.hpp>
 #include <range/v3/algorithm/stable_sort.hpp>
 #include <range/v3/algorithm/swap_ranges.hpp>
 #include <range/v3/algorithm/transform.hpp>
+#include <range/v3/algorithm/transpose.hpp>
 #include <range/v3/algorithm/unique.hpp>
 #include <range/v3/algorithm/unique_copy.hpp>
 #include <range/v3/algorithm/upper_bound.hpp>
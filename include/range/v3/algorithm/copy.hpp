@@ -19,9 +19,14 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/data.hpp>
+#include <range/v3/size.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/copy.hpp>
+#include <range/v3/utility/elementwise.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/nontemporal.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/tagged_pair.hpp>
 #include <range/v3/algorithm/tagspec.hpp>
@@ -30,10 +35,82 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            template<typename I, typename T>
+            std::pair<I, T *> nontemporal_copy_n(I begin, std::ptrdiff_t n, T *out)
+            {
+                nontemporal_writer<T> w{out};
+                for(; n != 0; --n, ++begin)
+                    w.push(*begin);
+                return {begin, w.finish()};
+            }
+
+            template<typename U, typename T,
+                CONCEPT_REQUIRES_(Same<meta::_t<std::remove_cv<U>>, T>())>
+            std::pair<U *, T *> nontemporal_copy_n(U *begin, std::ptrdiff_t n, T *out)
+            {
+                nontemporal_copy_bytes(out, begin, static_cast<std::size_t>(n) * sizeof(T));
+                nontemporal_fence();
+                return {begin + n, out + n};
+            }
+
+            template<typename Rng, typename T>
+            std::pair<range_iterator_t<Rng>, T *>
+            nontemporal_copy_rng(Rng &rng, std::ptrdiff_t n, T *out, std::true_type)
+            {
+                T *const end = detail::nontemporal_copy_n(data(rng), n, out).second;
+                return {next(begin(rng), n), end};
+            }
+
+            template<typename Rng, typename T>
+            std::pair<range_iterator_t<Rng>, T *>
+            nontemporal_copy_rng(Rng &rng, std::ptrdiff_t n, T *out, std::false_type)
+            {
+                return detail::nontemporal_copy_n(begin(rng), n, out);
+            }
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
         struct copy_fn : aux::copy_fn
         {
+        private:
+            template<typename I, typename S, typename O>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(I begin, S end, O out, std::false_type)
+            {
+                detail::reserve_output(out, begin, end);
+                for(; begin != end; ++begin, ++out)
+                    *out = *begin;
+                return {begin, out};
+            }
+            // Forward ranges copied into a container: one range insert.
+            template<typename I, typename O>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(I begin, I end, O out, std::true_type)
+            {
+                detail::bulk_insert(out, std::move(begin), end);
+                return {end, out};
+            }
+            template<typename Rng, typename O>
+            static tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
+            impl_rng(Rng &&rng, O out, std::false_type)
+            {
+                return copy_fn{}(begin(rng), end(rng), std::move(out));
+            }
+            // Elementwise expressions: a flat indexed loop.
+            template<typename Rng, typename O>
+            static tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
+            impl_rng(Rng &&rng, O out, std::true_type)
+            {
+                auto const n = static_cast<range_difference_t<Rng>>(size(rng));
+                out = detail::elementwise_copy(rng, std::move(out));
+                return {begin(rng) + n, std::move(out)};
+            }
+        public:
             using aux::copy_fn::operator();
 
             template<typename I, typename S, typename O,
@@ -45,9 +122,8 @@ namespace ranges
             tagged_pair<tag::in(I), tag::out(O)>
             operator()(I begin, S end, O out) const
             {
-                for(; begin != end; ++begin, ++out)
-                    *out = *begin;
-                return {begin, out};
+                return copy_fn::impl(std::move(begin), std::move(end), std::move(out),
+                    detail::BulkInsertable<O, I, S>{});
             }
 
             template<typename Rng, typename O,
@@ -60,7 +136,48 @@ namespace ranges
             tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
             operator()(Rng &&rng, O out) const
             {
-                return (*this)(begin(rng), end(rng), std::move(out));
+                return copy_fn::impl_rng(std::forward<Rng>(rng), std::move(out),
+                    meta::strict_and<detail::ElementwiseExpression<Rng>,
+                        RandomAccessIterator<O>>{});
+            }
+
+            /// \overload
+            /// Writes a destination of at least `nt.threshold()` bytes with
+            /// streaming stores.
+            template<typename I, typename S, typename T,
+                CONCEPT_REQUIRES_(
+                    InputIterator<I>() && SizedSentinel<S, I>() &&
+                    detail::NontemporalOutput<T *>() &&
+                    IndirectlyCopyable<I, T *>()
+                )>
+            tagged_pair<tag::in(I), tag::out(T *)>
+            operator()(I begin, S end, T *out, nontemporal_t nt) const
+            {
+                auto const n = static_cast<std::ptrdiff_t>(end - begin);
+                if(static_cast<std::size_t>(n) * sizeof(T) < nt.threshold())
+                    return (*this)(std::move(begin), std::move(end), out);
+                auto const res = detail::nontemporal_copy_n(std::move(begin), n, out);
+                return {res.first, res.second};
+            }
+
+            /// \overload
+            template<typename Rng, typename T,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(
+                    InputRange<Rng>() && SizedRange<Rng>() &&
+                    detail::NontemporalOutput<T *>() &&
+                    IndirectlyCopyable<I, T *>()
+                )>
+            tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(T *)>
+            operator()(Rng &&rng, T *out, nontemporal_t nt) const
+            {
+                auto const n = static_cast<std::ptrdiff_t>(size(rng));
+                if(static_cast<std::size_t>(n) * sizeof(T) < nt.threshold())
+                    return (*this)(begin(rng), end(rng), out);
+                auto const res = detail::nontemporal_copy_rng(rng, n, out,
+                    meta::bool_<ContiguousRange<Rng>() &&
+                        Same<range_value_t<Rng>, T>()>{});
+                return {res.first, res.second};
             }
         };
 
@@ -17,8 +17,11 @@
 #include <functional>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/data.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/utility/cpu_dispatch.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
@@ -34,12 +37,10 @@ namespace ranges
         /// @{
         struct copy_if_fn
         {
-            template<typename I, typename S, typename O, typename F, typename P = ident,
-                CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>() &&
-                    WeaklyIncrementable<O>() && IndirectPredicate<F, projected<I, P> >() &&
-                    IndirectlyCopyable<I, O>())>
-            tagged_pair<tag::in(I), tag::out(O)>
-            operator()(I begin, S end, O out, F pred, P proj = P{}) const
+        private:
+            template<typename I, typename S, typename O, typename F, typename P>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(I begin, S end, O out, F &pred, P &proj, std::false_type)
             {
                 for(; begin != end; ++begin)
                 {
@@ -52,6 +53,39 @@ namespace ranges
                 }
                 return {begin, out};
             }
+            // Contiguous arithmetic values: use the kernel for the processor.
+            template<typename I, typename O, typename F, typename P>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(I begin, I end, O out, F &pred, P &, std::true_type)
+            {
+                return {end, detail::simd_copy_if(begin, end, out, pred)};
+            }
+            template<typename Rng, typename O, typename F, typename P>
+            static tagged_pair<tag::in(range_iterator_t<Rng>), tag::out(O)>
+            impl_rng(Rng &rng, O out, F &pred, P &proj, std::false_type)
+            {
+                return copy_if_fn::impl(begin(rng), end(rng), std::move(out), pred, proj,
+                    std::false_type{});
+            }
+            template<typename Rng, typename O, typename F, typename P>
+            static tagged_pair<tag::in(range_iterator_t<Rng>), tag::out(O)>
+            impl_rng(Rng &rng, O out, F &pred, P &, std::true_type)
+            {
+                auto const first = data(rng);
+                auto const n = static_cast<std::ptrdiff_t>(size(rng));
+                return {begin(rng) + n, detail::simd_copy_if(first, first + n, out, pred)};
+            }
+        public:
+            template<typename I, typename S, typename O, typename F, typename P = ident,
+                CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>() &&
+                    WeaklyIncrementable<O>() && IndirectPredicate<F, projected<I, P> >() &&
+                    IndirectlyCopyable<I, O>())>
+            tagged_pair<tag::in(I), tag::out(O)>
+            operator()(I begin, S end, O out, F pred, P proj = P{}) const
+            {
+                return copy_if_fn::impl(std::move(begin), std::move(end), std::move(out), pred,
+                    proj, detail::SimdFilterable<I, S, O, P>{});
+            }
 
             template<typename Rng, typename O, typename F, typename P = ident,
                 typename I = range_iterator_t<Rng>,
@@ -60,7 +94,9 @@ namespace ranges
             tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
             operator()(Rng &&rng, O out, F pred, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(out), std::move(pred), std::move(proj));
+                return copy_if_fn::impl_rng(rng, std::move(out), pred, proj,
+                    meta::strict_and<detail::SimdArithmeticRange<Rng, P>,
+                        std::is_same<O, range_value_t<Rng> *>>{});
             }
         };
 
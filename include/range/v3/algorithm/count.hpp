@@ -18,10 +18,12 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/utility/cpu_dispatch.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/unwrap_any.hpp>
 
 namespace ranges
 {
@@ -31,11 +33,10 @@ namespace ranges
         /// @{
         struct count_fn
         {
-            template<typename I, typename S, typename V, typename P = ident,
-                CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>() &&
-                    IndirectRelation<equal_to, projected<I, P>, V const *>())>
-            iterator_difference_t<I>
-            operator()(I begin, S end, V const & val, P proj = P{}) const
+        private:
+            template<typename I, typename S, typename V, typename P>
+            static iterator_difference_t<I>
+            impl(I begin, S end, V const &val, P &proj, std::false_type)
             {
                 iterator_difference_t<I> n = 0;
                 for(; begin != end; ++begin)
@@ -43,6 +44,45 @@ namespace ranges
                         ++n;
                 return n;
             }
+            // Contiguous integers: use the kernel for the processor.
+            template<typename I, typename V, typename P>
+            static iterator_difference_t<I> impl(I begin, I end, V const &val, P &, std::true_type)
+            {
+                return detail::simd_count(begin, end, val);
+            }
+            template<typename Rng, typename V, typename P>
+            static range_difference_t<Rng> impl_rng(Rng &rng, V const &val, P &proj, std::false_type)
+            {
+                return count_fn::impl(begin(rng), end(rng), val, proj, std::false_type{});
+            }
+            template<typename Rng, typename V, typename P>
+            static range_difference_t<Rng> impl_rng(Rng &rng, V const &val, P &, std::true_type)
+            {
+                auto const first = data(rng);
+                return detail::simd_count(first, first + static_cast<std::ptrdiff_t>(size(rng)), val);
+            }
+            template<typename V, typename P>
+            struct impl_rng_fn
+            {
+                V const &val;
+                P &proj;
+                template<typename Rng>
+                range_difference_t<Rng> operator()(Rng &rng) const
+                {
+                    return count_fn::impl_rng(rng, val, proj,
+                        detail::SimdSearchableRange<Rng, P, V>{});
+                }
+            };
+        public:
+            template<typename I, typename S, typename V, typename P = ident,
+                CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>() &&
+                    IndirectRelation<equal_to, projected<I, P>, V const *>())>
+            iterator_difference_t<I>
+            operator()(I begin, S end, V const & val, P proj = P{}) const
+            {
+                return count_fn::impl(std::move(begin), std::move(end), val, proj,
+                    detail::SimdSearchable<I, S, P, V>{});
+            }
 
             template<typename Rng, typename V, typename P = ident,
                 typename I = range_iterator_t<Rng>,
@@ -51,7 +91,7 @@ namespace ranges
             iterator_difference_t<I>
             operator()(Rng &&rng, V const & val, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), val, std::move(proj));
+                return unwrap_any(rng, impl_rng_fn<V, P>{val, proj});
             }
         };
 
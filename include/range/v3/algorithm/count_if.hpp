@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_COUNT_IF_HPP
 #define RANGES_V3_ALGORITHM_COUNT_IF_HPP
 
+#include <functional>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
@@ -22,6 +23,7 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/unwrap_any.hpp>
 
 namespace ranges
 {
@@ -31,6 +33,19 @@ namespace ranges
         /// @{
         struct count_if_fn
         {
+        private:
+            template<typename R, typename P>
+            struct impl_rng_fn
+            {
+                R &pred;
+                P &proj;
+                template<typename Rng>
+                iterator_difference_t<range_iterator_t<Rng>> operator()(Rng &rng) const
+                {
+                    return count_if_fn{}(begin(rng), end(rng), std::ref(pred), std::ref(proj));
+                }
+            };
+        public:
             template<typename I, typename S, typename R, typename P = ident,
                 CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>() &&
                     IndirectPredicate<R, projected<I, P> >())>
@@ -50,7 +65,7 @@ namespace ranges
             iterator_difference_t<I>
             operator()(Rng &&rng, R pred, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+                return unwrap_any(rng, impl_rng_fn<R, P>{pred, proj});
             }
         };
 
@@ -16,9 +16,12 @@
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/data.hpp>
 #include <range/v3/distance.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/utility/cpu_dispatch.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -44,6 +47,42 @@ namespace ranges
                 return begin0 == end0 && begin1 == end1;
             }
 
+            template<typename I0, typename S0, typename I1, typename C, typename P0,
+                typename P1>
+            static bool impl(I0 begin0, S0 end0, I1 begin1, C &pred, P0 &proj0, P1 &proj1,
+                std::false_type)
+            {
+                for(; begin0 != end0; ++begin0, ++begin1)
+                    if(!invoke(pred, invoke(proj0, *begin0), invoke(proj1, *begin1)))
+                        return false;
+                return true;
+            }
+            // Contiguous integers: use the kernel for the processor.
+            template<typename I0, typename I1, typename C, typename P0, typename P1>
+            static bool impl(I0 begin0, I0 end0, I1 begin1, C &, P0 &, P1 &, std::true_type)
+            {
+                return detail::simd_mismatch(begin0, end0, begin1) == end0;
+            }
+            template<typename Rng0, typename Rng1, typename C, typename P0, typename P1>
+            bool impl_rng(Rng0 &rng0, Rng1 &rng1, C &pred, P0 &proj0, P1 &proj1,
+                std::false_type) const
+            {
+                if(SizedRange<Rng0>() && SizedRange<Rng1>())
+                    if(distance(rng0) != distance(rng1))
+                        return false;
+                return this->nocheck(begin(rng0), end(rng0), begin(rng1), end(rng1),
+                    std::move(pred), std::move(proj0), std::move(proj1));
+            }
+            template<typename Rng0, typename Rng1, typename C, typename P0, typename P1>
+            bool impl_rng(Rng0 &rng0, Rng1 &rng1, C &, P0 &, P1 &, std::true_type) const
+            {
+                auto const n = static_cast<std::ptrdiff_t>(size(rng0));
+                if(n != static_cast<std::ptrdiff_t>(size(rng1)))
+                    return false;
+                auto const first = data(rng0);
+                return detail::simd_mismatch(first, first + n, data(rng1)) == first + n;
+            }
+
         public:
             template<typename I0, typename S0, typename I1,
                 typename C = equal_to, typename P0 = ident, typename P1 = ident,
@@ -54,10 +93,9 @@ namespace ranges
             bool operator()(I0 begin0, S0 end0, I1 begin1, C pred = C{},
                 P0 proj0 = P0{}, P1 proj1 = P1{}) const
             {
-                for(; begin0 != end0; ++begin0, ++begin1)
-                    if(!invoke(pred, invoke(proj0, *begin0), invoke(proj1, *begin1)))
-                        return false;
-                return true;
+                return equal_fn::impl(std::move(begin0), std::move(end0), std::move(begin1),
+                    pred, proj0, proj1, meta::strict_and<std::is_pointer<I1>,
+                        detail::SimdComparable<I0, S0, I1, C, P0, P1>>{});
             }
 
             template<typename I0, typename S0, typename I1, typename S1,
@@ -72,6 +110,10 @@ namespace ranges
                 if(SizedSentinel<S0, I0>() && SizedSentinel<S1, I1>())
                     if(distance(begin0, end0) != distance(begin1, end1))
                         return false;
+                if(meta::strict_and<std::is_same<I1, S1>,
+                    std::is_pointer<I1>, detail::SimdComparable<I0, S0, I1, C, P0, P1>>())
+                    return (*this)(std::move(begin0), std::move(end0), std::move(begin1),
+                        std::move(pred), std::move(proj0), std::move(proj1));
                 return this->nocheck(std::move(begin0), std::move(end0), std::move(begin1),
                     std::move(end1), std::move(pred), std::move(proj0), std::move(proj1));
             }
@@ -102,11 +144,9 @@ namespace ranges
             bool operator()(Rng0 && rng0, Rng1 && rng1, C pred = C{}, P0 proj0 = P0{},
                 P1 proj1 = P1{}) const
             {
-                if(SizedRange<Rng0>() && SizedRange<Rng1>())
-                    if(distance(rng0) != distance(rng1))
-                        return false;
-                return this->nocheck(begin(rng0), end(rng0), begin(rng1), end(rng1),
-                    std::move(pred), std::move(proj0), std::move(proj1));
+                return this->impl_rng(rng0, rng1, pred, proj0, proj1, meta::strict_and<
+                    ContiguousRange<Rng1>, SizedRange<Rng1>,
+                    detail::SimdComparableRange<Rng0, Rng1, C, P0, P1>>{});
             }
         };
 
@@ -13,11 +13,17 @@
 #ifndef RANGES_V3_ALGORITHM_FILL_HPP
 #define RANGES_V3_ALGORITHM_FILL_HPP
 
+#include <cstring>
+#include <type_traits>
+#include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/data.hpp>
+#include <range/v3/size.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/nontemporal.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -44,6 +50,45 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), val);
             }
+
+            /// \overload
+            /// Writes a destination of at least `nt.threshold()` bytes with
+            /// streaming stores.
+            template<typename T, typename V,
+                CONCEPT_REQUIRES_(detail::NontemporalOutput<T *>() &&
+                    Writable<T *, V const &>())>
+            T *operator()(T *begin, T *end, V const & val, nontemporal_t nt) const
+            {
+                auto n = static_cast<std::size_t>(end - begin);
+                if(n * sizeof(T) < nt.threshold())
+                    return (*this)(begin, end, val);
+                // Stream a buffer full of copies of val over and over.
+                constexpr std::size_t k = detail::nontemporal_writer<T>::capacity;
+                alignas(16) unsigned char buf[k * sizeof(T)];
+                T const t = val;
+                for(std::size_t i = 0; i < k && i < n; ++i)
+                    std::memcpy(buf + i * sizeof(T), &t, sizeof(T));
+                for(std::size_t m; n != 0; n -= m, begin += m)
+                {
+                    m = n < k ? n : k;
+                    detail::nontemporal_copy_bytes(begin, buf, m * sizeof(T));
+                }
+                detail::nontemporal_fence();
+                return begin;
+            }
+
+            /// \overload
+            template<typename Rng, typename V,
+                typename T = meta::_t<std::remove_reference<range_reference_t<Rng>>>,
+                CONCEPT_REQUIRES_(ContiguousRange<Rng>() && SizedRange<Rng>() &&
+                    detail::NontemporalOutput<T *>() && Writable<T *, V const &>())>
+            range_safe_iterator_t<Rng> operator()(Rng &&rng, V const & val, nontemporal_t nt) const
+            {
+                T *const p = data(rng);
+                auto const n = static_cast<std::ptrdiff_t>(size(rng));
+                (*this)(p, p + n, val, nt);
+                return next(begin(rng), n);
+            }
         };
 
         /// \sa `fill_fn`
@@ -20,6 +20,7 @@
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/cpu_dispatch.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -31,6 +32,34 @@ namespace ranges
         /// @{
         struct find_fn
         {
+        private:
+            template<typename I, typename S, typename V, typename P>
+            static I impl(I begin, S end, V const &val, P &proj, std::false_type)
+            {
+                for(; begin != end; ++begin)
+                    if(invoke(proj, *begin) == val)
+                        break;
+                return begin;
+            }
+            // Contiguous integers: use the kernel for the processor.
+            template<typename I, typename V, typename P>
+            static I impl(I begin, I end, V const &val, P &, std::true_type)
+            {
+                return begin + (detail::simd_find(begin, end, val) - begin);
+            }
+            template<typename Rng, typename V, typename P>
+            static range_iterator_t<Rng> impl_rng(Rng &rng, V const &val, P &proj, std::false_type)
+            {
+                return find_fn::impl(begin(rng), end(rng), val, proj, std::false_type{});
+            }
+            template<typename Rng, typename V, typename P>
+            static range_iterator_t<Rng> impl_rng(Rng &rng, V const &val, P &, std::true_type)
+            {
+                auto const first = data(rng);
+                auto const last = first + static_cast<std::ptrdiff_t>(size(rng));
+                return begin(rng) + (detail::simd_find(first, last, val) - first);
+            }
+        public:
             /// \brief template function \c find_fn::operator()
             ///
             /// range-based version of the \c find std algorithm
@@ -45,10 +74,8 @@ namespace ranges
                     IndirectRelation<equal_to, projected<I, P>, V const *>())>
             I operator()(I begin, S end, V const &val, P proj = P{}) const
             {
-                for(; begin != end; ++begin)
-                    if(invoke(proj, *begin) == val)
-                        break;
-                return begin;
+                return find_fn::impl(std::move(begin), std::move(end), val, proj,
+                    detail::SimdSearchable<I, S, P, V>{});
             }
 
             /// \overload
@@ -58,7 +85,7 @@ namespace ranges
                     IndirectRelation<equal_to, projected<I, P>, V const *>())>
             range_safe_iterator_t<Rng> operator()(Rng &&rng, V const &val, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), val, std::move(proj));
+                return find_fn::impl_rng(rng, val, proj, detail::SimdSearchableRange<Rng, P, V>{});
             }
         };
 
@@ -13,11 +13,20 @@
 #ifndef RANGES_V3_ALGORITHM_FIND_FIRST_OF_HPP
 #define RANGES_V3_ALGORITHM_FIND_FIRST_OF_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 #include <utility>
+#include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/data.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/utility/cpu_dispatch.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -27,10 +36,171 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // Whether find_first_of can look the elements up in a set of the
+            // needles: they are integers of the same type, compared with
+            // equal_to and not projected.
+            template<typename I0, typename I1, typename R, typename P0, typename P1>
+            using IntegerSetSearchable = meta::strict_and<
+                std::is_same<R, equal_to>,
+                std::is_same<P0, ident>,
+                std::is_same<P1, ident>,
+                SimdElement<iterator_value_t<I0>>,
+                std::is_same<iterator_value_t<I0>, iterator_value_t<I1>>>;
+
+            // With fewer needles than this, comparing each element with each
+            // of them is faster than hashing it.
+            constexpr std::ptrdiff_t integer_set_min_size = 4;
+
+            // The most needles an integer_set holds. With more, find_first_of
+            // compares each element with each needle rather than allocate.
+            constexpr std::ptrdiff_t integer_set_max_size = 64;
+
+            // An open-addressing hash set of integers, with room for twice as
+            // many as it holds, stored inline.
+            template<typename T>
+            struct integer_set
+            {
+            private:
+                using U = meta::_t<std::make_unsigned<T>>;
+                static constexpr std::size_t capacity = 2 * integer_set_max_size;
+                std::array<T, capacity> slots_;
+                std::array<unsigned char, capacity> used_;
+                std::size_t mask_;
+                unsigned shift_;
+
+                std::size_t slot(T t) const noexcept
+                {
+                    return static_cast<std::size_t>((static_cast<std::uint64_t>(static_cast<U>(t)) *
+                        0x9E3779B97F4A7C15ull) >> shift_);
+                }
+            public:
+                explicit integer_set(std::size_t n)
+                  : used_{}, mask_{}, shift_{64}
+                {
+                    RANGES_EXPECT(n <= static_cast<std::size_t>(integer_set_max_size));
+                    std::size_t size = 1;
+                    for(; size < 2 * n; size *= 2)
+                        --shift_;
+                    mask_ = size - 1;
+                }
+                void insert(T t)
+                {
+                    std::size_t i = slot(t);
+                    for(; used_[i]; i = (i + 1) & mask_)
+                        if(slots_[i] == t)
+                            return;
+                    slots_[i] = t;
+                    used_[i] = 1;
+                }
+                bool contains(T t) const noexcept
+                {
+                    for(std::size_t i = slot(t); used_[i]; i = (i + 1) & mask_)
+                        if(slots_[i] == t)
+                            return true;
+                    return false;
+                }
+            };
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
         struct find_first_of_fn
         {
+        private:
+            template<typename I0, typename S0, typename I1, typename S1, typename R,
+                typename P0, typename P1>
+            static I0 impl(I0 begin0, S0 end0, I1 begin1, S1 end1, R &pred, P0 &proj0,
+                P1 &proj1, std::false_type)
+            {
+                for(; begin0 != end0; ++begin0)
+                    for(auto tmp = begin1; tmp != end1; ++tmp)
+                        if(invoke(pred, invoke(proj0, *begin0), invoke(proj1, *tmp)))
+                            return begin0;
+                return begin0;
+            }
+            // Integers: look each element up in a set of the needles.
+            template<typename I0, typename S0, typename I1, typename S1, typename R,
+                typename P0, typename P1>
+            static I0 impl(I0 begin0, S0 end0, I1 begin1, S1 end1, R &pred, P0 &proj0,
+                P1 &proj1, std::true_type)
+            {
+                return find_first_of_fn::impl_set(std::move(begin0), std::move(end0),
+                    std::move(begin1), std::move(end1), pred, proj0, proj1,
+                    meta::bool_<sizeof(iterator_value_t<I0>) == 1>{});
+            }
+
+            // Bytes: a 256-bit table.
+            template<typename I0, typename S0, typename I1, typename S1, typename R,
+                typename P0, typename P1>
+            static I0 impl_set(I0 begin0, S0 end0, I1 begin1, S1 end1, R &, P0 &, P1 &,
+                std::true_type)
+            {
+                detail::byte_set set{};
+                for(; begin1 != end1; ++begin1)
+                    set.insert(static_cast<unsigned char>(*begin1));
+                return find_first_of_fn::find_bytes(std::move(begin0), std::move(end0), set);
+            }
+            template<typename I0, typename S0>
+            static I0 find_bytes(I0 begin0, S0 end0, detail::byte_set const &set)
+            {
+                for(; begin0 != end0; ++begin0)
+                    if(set.contains(static_cast<unsigned char>(*begin0)))
+                        break;
+                return begin0;
+            }
+            // Contiguous bytes: use the kernel for the processor.
+            template<typename T>
+            static T *find_bytes(T *begin0, T *end0, detail::byte_set const &set)
+            {
+                auto const first = reinterpret_cast<unsigned char const *>(begin0);
+                return begin0 + (detail::simd_find_byte_of(first,
+                    reinterpret_cast<unsigned char const *>(end0), set) - first);
+            }
+
+            // Wider integers: a hash set, if there are enough needles and it
+            // fits inline.
+            template<typename I0, typename S0, typename I1, typename S1, typename R,
+                typename P0, typename P1>
+            static I0 impl_set(I0 begin0, S0 end0, I1 begin1, S1 end1, R &pred, P0 &proj0,
+                P1 &proj1, std::false_type)
+            {
+                if(iter_distance_compare(begin1, end1, detail::integer_set_min_size) < 0 ||
+                    iter_distance_compare(begin1, end1, detail::integer_set_max_size) > 0)
+                    return find_first_of_fn::impl(std::move(begin0), std::move(end0),
+                        std::move(begin1), std::move(end1), pred, proj0, proj1,
+                        std::false_type{});
+                detail::integer_set<iterator_value_t<I0>> set{
+                    static_cast<std::size_t>(iter_distance(begin1, end1))};
+                for(; begin1 != end1; ++begin1)
+                    set.insert(*begin1);
+                for(; begin0 != end0; ++begin0)
+                    if(set.contains(*begin0))
+                        break;
+                return begin0;
+            }
+
+            template<typename Rng0, typename Rng1, typename R, typename P0, typename P1>
+            static range_iterator_t<Rng0> impl_rng(Rng0 &rng0, Rng1 &rng1, R &pred,
+                P0 &proj0, P1 &proj1, std::false_type)
+            {
+                return find_first_of_fn::impl(begin(rng0), end(rng0), begin(rng1), end(rng1),
+                    pred, proj0, proj1, detail::IntegerSetSearchable<range_iterator_t<Rng0>,
+                        range_iterator_t<Rng1>, R, P0, P1>{});
+            }
+            template<typename Rng0, typename Rng1, typename R, typename P0, typename P1>
+            static range_iterator_t<Rng0> impl_rng(Rng0 &rng0, Rng1 &rng1, R &pred,
+                P0 &proj0, P1 &proj1, std::true_type)
+            {
+                auto const first = data(rng0);
+                auto const last = first + static_cast<std::ptrdiff_t>(size(rng0));
+                return begin(rng0) + (find_first_of_fn::impl(first, last, begin(rng1),
+                    end(rng1), pred, proj0, proj1, std::true_type{}) - first);
+            }
+        public:
             // Rationale: return I0 instead of pair<I0,I1> because find_first_of need
             // not actually compute the end of [I1,S0); therefore, it is not necessarily
             // losing information. E.g., if begin0 == end0, we can return begin0 immediately.
@@ -43,11 +213,9 @@ namespace ranges
             I0 operator()(I0 begin0, S0 end0, I1 begin1, S1 end1, R pred = R{}, P0 proj0 = P0{},
                 P1 proj1 = P1{}) const
             {
-                for(; begin0 != end0; ++begin0)
-                    for(auto tmp = begin1; tmp != end1; ++tmp)
-                        if(invoke(pred, invoke(proj0, *begin0), invoke(proj1, *tmp)))
-                            return begin0;
-                return begin0;
+                return find_first_of_fn::impl(std::move(begin0), std::move(end0),
+                    std::move(begin1), std::move(end1), pred, proj0, proj1,
+                    detail::IntegerSetSearchable<I0, I1, R, P0, P1>{});
             }
 
             template<typename Rng0, typename Rng1, typename R = equal_to,
@@ -59,8 +227,10 @@ namespace ranges
             range_safe_iterator_t<Rng0> operator()(Rng0 &&rng0, Rng1 &&rng1, R pred = R{}, P0 proj0 = P0{},
                 P1 proj1 = P1{}) const
             {
-                return (*this)(begin(rng0), end(rng0), begin(rng1), end(rng1), std::move(pred),
-                    std::move(proj0), std::move(proj1));
+                return find_first_of_fn::impl_rng(rng0, rng1, pred, proj0, proj1,
+                    meta::strict_and<
+                        detail::SimdSearchableRange<Rng0, P0>,
+                        detail::IntegerSetSearchable<I0, I1, R, P0, P1>>{});
             }
         };
 
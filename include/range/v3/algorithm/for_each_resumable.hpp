@@ -0,0 +1,116 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_FOR_EACH_RESUMABLE_HPP
+#define RANGES_V3_ALGORITHM_FOR_EACH_RESUMABLE_HPP
+
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/work_budget.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// The state of a `for_each` that runs a budgeted slice of the range
+        /// at a time. Nothing is done until the first call to `resume`.
+        template<typename I, typename S, typename F, typename P>
+        struct for_each_resumable_state
+        {
+        private:
+            I begin_;
+            S end_;
+            F fun_;
+            P proj_;
+            resumable_status status_;
+        public:
+            for_each_resumable_state(I begin, S end, F fun, P proj)
+              : begin_(std::move(begin)), end_(std::move(end)), fun_(std::move(fun))
+              , proj_(std::move(proj)), status_(resumable_status::suspended)
+            {}
+            /// Applies the function to elements until the range is exhausted,
+            /// `budget` is spent, or `token` is cancelled. Once the algorithm
+            /// is done or cancelled, further calls do nothing.
+            resumable_status resume(work_budget const &budget,
+                cancellation_token const &token = cancellation_token{})
+            {
+                if(status_ != resumable_status::suspended)
+                    return status_;
+                detail::budget_meter meter{budget, token};
+                for(; begin_ != end_; ++begin_)
+                {
+                    if(!meter.spend())
+                        return status_ = meter.stopped();
+                    invoke(fun_, invoke(proj_, *begin_));
+                }
+                return status_ = resumable_status::done;
+            }
+            resumable_status status() const
+            {
+                return status_;
+            }
+            bool done() const
+            {
+                return status_ == resumable_status::done;
+            }
+            /// The next element to be processed.
+            I position() const
+            {
+                return begin_;
+            }
+            F const &fun() const
+            {
+                return fun_;
+            }
+        };
+
+        struct for_each_resumable_fn
+        {
+            template<typename I, typename S, typename F, typename P = ident,
+                CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>() &&
+                    IndirectInvocable<F, projected<I, P>>())>
+            for_each_resumable_state<I, S, F, P>
+            operator()(I begin, S end, F fun, P proj = P{}) const
+            {
+                return {std::move(begin), std::move(end), std::move(fun), std::move(proj)};
+            }
+
+            /// \pre The range must outlive the returned state.
+            template<typename Rng, typename F, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(InputRange<Rng>() &&
+                    IndirectInvocable<F, projected<I, P>>())>
+            for_each_resumable_state<I, range_sentinel_t<Rng>, F, P>
+            operator()(Rng &rng, F fun, P proj = P{}) const
+            {
+                return {begin(rng), end(rng), std::move(fun), std::move(proj)};
+            }
+        };
+
+        /// \sa `for_each_resumable_fn`
+        /// \ingroup group-algorithms
+        RANGES_INLINE_VARIABLE(for_each_resumable_fn, for_each_resumable)
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
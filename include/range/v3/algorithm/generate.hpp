@@ -13,12 +13,17 @@
 #ifndef RANGES_V3_ALGORITHM_GENERATE_HPP
 #define RANGES_V3_ALGORITHM_GENERATE_HPP
 
+#include <cstdint>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/philox.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/tagged_pair.hpp>
 #include <range/v3/algorithm/tagspec.hpp>
@@ -27,6 +32,28 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // Writes dist(e) to first[i] for each i in [0, n), where e is
+            // stream i of seed and dist is a fresh copy, so that element i does
+            // not depend on how [0, n) is split between threads.
+            template<typename I, typename D>
+            void parallel_generate(I first, std::ptrdiff_t n, D const &dist, std::uint64_t seed)
+            {
+                detail::parallel_chunks(n, [&](std::ptrdiff_t, std::ptrdiff_t lo, std::ptrdiff_t hi)
+                {
+                    for(; lo != hi; ++lo)
+                    {
+                        philox4x32 e{seed, static_cast<std::uint64_t>(lo)};
+                        D d = dist;
+                        first[lo] = invoke(d, e);
+                    }
+                });
+            }
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
         struct generate_fn
@@ -53,6 +80,22 @@ namespace ranges
                 return {(*this)(begin(rng), end(rng), ref(fun)).out(),
                     detail::move(fun)};
             }
+
+            /// Fills `rng` in parallel with values of the random distribution
+            /// `dist`. Element `i` is `d(e)`, where `d` is a copy of `dist`
+            /// and `e` is `philox4x32{seed, i}`. The result depends only on
+            /// `seed`, not on the number of threads.
+            template<typename Rng, typename D,
+                typename O = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>() && SizedRange<Rng>() &&
+                    CopyConstructible<D>() && Invocable<D&, philox4x32&>() &&
+                    OutputRange<Rng, result_of_t<D&(philox4x32&)> &&>())>
+            range_safe_iterator_t<Rng> operator()(par_t, Rng &&rng, D dist, std::uint64_t seed) const
+            {
+                auto const n = static_cast<std::ptrdiff_t>(size(rng));
+                detail::parallel_generate(begin(rng), n, dist, seed);
+                return begin(rng) + n;
+            }
         };
 
         /// \sa `generate_fn`
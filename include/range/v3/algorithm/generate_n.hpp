@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_GENERATE_N_HPP
 #define RANGES_V3_ALGORITHM_GENERATE_N_HPP
 
+#include <cstdint>
 #include <tuple>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
@@ -23,6 +24,7 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/tagged_pair.hpp>
+#include <range/v3/algorithm/generate.hpp>
 #include <range/v3/algorithm/tagspec.hpp>
 
 namespace ranges
@@ -46,6 +48,20 @@ namespace ranges
                     *b = invoke(fun);
                 return {recounted(begin, b, norig), detail::move(fun)};
             }
+
+            /// Writes `n` values of the random distribution `dist` in parallel,
+            /// like `generate(par, rng, dist, seed)`.
+            template<typename O, typename D,
+                CONCEPT_REQUIRES_(RandomAccessIterator<O>() &&
+                    CopyConstructible<D>() && Invocable<D&, philox4x32&>() &&
+                    OutputIterator<O, result_of_t<D&(philox4x32&)> &&>())>
+            O operator()(par_t, O begin, iterator_difference_t<O> n, D dist,
+                std::uint64_t seed) const
+            {
+                RANGES_EXPECT(n >= 0);
+                detail::parallel_generate(begin, static_cast<std::ptrdiff_t>(n), dist, seed);
+                return begin + n;
+            }
         };
 
         /// \sa `generate_n_fn`
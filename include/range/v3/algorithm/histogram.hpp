@@ -0,0 +1,232 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_HISTOGRAM_HPP
+#define RANGES_V3_ALGORITHM_HISTOGRAM_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// A bucket function for `histogram` that splits `[lo, hi)` into `n`
+        /// equal bins. Values below `lo` (and NaNs) land in the first bin and
+        /// values at or above `hi` in the last. The bin width is inverted once
+        /// up front, so binning costs a subtraction and a multiplication.
+        template<typename T>
+        struct uniform_bucket
+        {
+            static_assert(std::is_floating_point<T>::value,
+                "uniform_bucket requires a floating-point value type.");
+        private:
+            T lo_ = T(0);
+            T scale_ = T(1);
+            std::ptrdiff_t last_ = 0;
+        public:
+            uniform_bucket() = default;
+            uniform_bucket(T lo, T hi, std::ptrdiff_t n)
+              : lo_(lo), scale_(static_cast<T>(n) / (hi - lo)), last_(n - 1)
+            {
+                RANGES_EXPECT(lo < hi && 0 < n);
+            }
+            std::ptrdiff_t operator()(T x) const
+            {
+                T const pos = (x - lo_) * scale_;
+                if(!(pos >= T(0)))
+                    return 0;
+                if(!(pos < static_cast<T>(last_)))
+                    return last_;
+                return static_cast<std::ptrdiff_t>(pos);
+            }
+        };
+
+        struct histogram_fn
+        {
+        private:
+            // Consecutive elements are counted into different private copies of
+            // the bins so that a run of equal buckets does not serialize on
+            // store-to-load forwarding through a single counter.
+            static constexpr std::ptrdiff_t sub_histograms_ = 4;
+            // Above this many bins the private copies no longer fit in L1 and
+            // cost more than they save.
+            static constexpr std::ptrdiff_t sub_histogram_limit_ = 1024;
+
+            struct as_unsigned_char_
+            {
+                template<typename T>
+                unsigned char operator()(T t) const
+                {
+                    return static_cast<unsigned char>(t);
+                }
+            };
+
+            template<typename I, typename P>
+            using ByteFastPath = meta::strict_and<
+                std::is_same<P, ident>,
+                Integral<iterator_value_t<I>>,
+                meta::bool_<sizeof(iterator_value_t<I>) == 1>>;
+
+            // Adds the count of each bucket of [begin, end) to out[0, nbins).
+            template<typename I, typename S, typename P>
+            static I count_into(I begin, S end, std::size_t *out, std::ptrdiff_t nbins,
+                P &proj, std::false_type)
+            {
+                std::ptrdiff_t const subs =
+                    nbins <= sub_histogram_limit_ ? sub_histograms_ : 1;
+                std::vector<std::size_t> local;
+                std::size_t *counts = out;
+                if(subs != 1)
+                {
+                    local.resize(static_cast<std::size_t>(subs * nbins));
+                    counts = local.data();
+                }
+                std::ptrdiff_t const span = subs * nbins;
+                for(std::ptrdiff_t offset = 0; begin != end; ++begin)
+                {
+                    auto const b = static_cast<std::ptrdiff_t>(invoke(proj, *begin));
+                    RANGES_EXPECT(0 <= b && b < nbins);
+                    ++counts[offset + b];
+                    offset += nbins;
+                    if(offset == span)
+                        offset = 0;
+                }
+                if(subs != 1)
+                    for(std::ptrdiff_t s = 0; s < subs; ++s)
+                        for(std::ptrdiff_t b = 0; b < nbins; ++b)
+                            out[b] += counts[s * nbins + b];
+                return begin;
+            }
+
+            // Bytes index the bins directly: no projection, no bounds checks,
+            // and the private copies live on the stack. With fewer bins than
+            // byte values, the bounds are checked on the unsigned value.
+            template<typename I, typename S, typename P>
+            static I count_into(I begin, S end, std::size_t *out, std::ptrdiff_t nbins,
+                P &, std::true_type)
+            {
+                if(nbins < 256)
+                {
+                    as_unsigned_char_ proj;
+                    return histogram_fn::count_into(std::move(begin), std::move(end), out,
+                        nbins, proj, std::false_type{});
+                }
+                std::size_t counts[sub_histograms_][256] = {};
+                for(std::ptrdiff_t s = 0; begin != end; ++begin)
+                {
+                    ++counts[s][static_cast<unsigned char>(*begin)];
+                    s = (s + 1) % sub_histograms_;
+                }
+                for(std::ptrdiff_t s = 0; s < sub_histograms_; ++s)
+                    for(int b = 0; b < 256; ++b)
+                        out[b] += counts[s][b];
+                return begin;
+            }
+
+            template<typename BI, typename C = iterator_value_t<BI>>
+            static void merge(BI bins, std::vector<std::size_t> const &counts)
+            {
+                for(std::size_t b = 0; b < counts.size(); ++b, ++bins)
+                    if(counts[b] != 0)
+                        *bins += static_cast<C>(counts[b]);
+            }
+
+        public:
+            /// Adds to `bins[b]` the number of elements `x` of `[begin, end)` for
+            /// which `invoke(bucket, x) == b`. Every bucket index must be in
+            /// `[0, distance(bins))`. When `bucket` is `ident` and the elements
+            /// are bytes, each byte is binned by its value as `unsigned char`.
+            template<typename I, typename S, typename BRng, typename P = ident,
+                CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>() &&
+                    RandomAccessRange<BRng>() &&
+                    Integral<range_value_t<BRng>>() &&
+                    Integral<uncvref_t<indirect_result_of_t<P &(I)>>>())>
+            I operator()(I begin, S end, BRng &&bins, P bucket = P{}) const
+            {
+                auto const nbins = static_cast<std::ptrdiff_t>(distance(bins));
+                std::vector<std::size_t> counts(static_cast<std::size_t>(nbins));
+                begin = histogram_fn::count_into(std::move(begin), std::move(end),
+                    counts.data(), nbins, bucket, ByteFastPath<I, P>{});
+                histogram_fn::merge(ranges::begin(bins), counts);
+                return begin;
+            }
+
+            /// \overload
+            template<typename Rng, typename BRng, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(InputRange<Rng>() &&
+                    RandomAccessRange<BRng>() &&
+                    Integral<range_value_t<BRng>>() &&
+                    Integral<uncvref_t<indirect_result_of_t<P &(I)>>>())>
+            range_safe_iterator_t<Rng>
+            operator()(Rng &&rng, BRng &&bins, P bucket = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), bins, std::move(bucket));
+            }
+
+            /// Like the sequential overload, but splits `rng` across threads,
+            /// each counting into its own bins; the per-thread bins are summed
+            /// at the end. `bucket` is copied into each thread.
+            template<typename Rng, typename BRng, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>() && SizedRange<Rng>() &&
+                    RandomAccessRange<BRng>() &&
+                    Integral<range_value_t<BRng>>() &&
+                    Integral<uncvref_t<indirect_result_of_t<P &(I)>>>() &&
+                    CopyConstructible<P>())>
+            range_safe_iterator_t<Rng>
+            operator()(par_t, Rng &&rng, BRng &&bins, P bucket = P{}) const
+            {
+                auto const first = begin(rng);
+                auto const n = static_cast<std::ptrdiff_t>(distance(rng));
+                auto const nbins = static_cast<std::ptrdiff_t>(distance(bins));
+                std::vector<std::vector<std::size_t>> counts(
+                    static_cast<std::size_t>(detail::parallel_chunk_count(n)));
+                detail::parallel_chunks(n,
+                    [&](std::ptrdiff_t chunk, std::ptrdiff_t lo, std::ptrdiff_t hi)
+                    {
+                        P proj = bucket;
+                        auto &local = counts[static_cast<std::size_t>(chunk)];
+                        local.resize(static_cast<std::size_t>(nbins));
+                        histogram_fn::count_into(first + lo, first + hi, local.data(),
+                            nbins, proj, ByteFastPath<I, P>{});
+                    });
+                for(auto const &local : counts)
+                    histogram_fn::merge(ranges::begin(bins), local);
+                return first + n;
+            }
+        };
+
+        /// \sa `histogram_fn`
+        /// \ingroup group-algorithms
+        RANGES_INLINE_VARIABLE(histogram_fn, histogram)
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -34,6 +34,7 @@
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -48,6 +49,21 @@ namespace ranges
         /// @{
         struct merge_fn
         {
+        private:
+            // Room for both ranges.
+            template<typename O, typename I0, typename S0, typename I1, typename S1,
+                CONCEPT_REQUIRES_(SizedSentinel<S0, I0>() && SizedSentinel<S1, I1>())>
+            static void reserve_output(O &out, I0 const &begin0, S0 const &end0,
+                I1 const &begin1, S1 const &end1)
+            {
+                detail::reserve_output(out, static_cast<std::ptrdiff_t>(end0 - begin0) +
+                    static_cast<std::ptrdiff_t>(end1 - begin1));
+            }
+            template<typename O, typename I0, typename S0, typename I1, typename S1,
+                CONCEPT_REQUIRES_(!(SizedSentinel<S0, I0>() && SizedSentinel<S1, I1>()))>
+            static void reserve_output(O &, I0 const &, S0 const &, I1 const &, S1 const &)
+            {}
+        public:
             template<typename I0, typename S0, typename I1, typename S1, typename O,
                 typename C = ordered_less, typename P0 = ident, typename P1 = ident,
                 CONCEPT_REQUIRES_(
@@ -59,6 +75,7 @@ namespace ranges
             operator()(I0 begin0, S0 end0, I1 begin1, S1 end1, O out, C pred = C{},
                 P0 proj0 = P0{}, P1 proj1 = P1{}) const
             {
+                merge_fn::reserve_output(out, begin0, end0, begin1, end1);
                 for(; begin0 != end0 && begin1 != end1; ++out)
                 {
                     if(invoke(pred, invoke(proj1, *begin1), invoke(proj0, *begin0)))
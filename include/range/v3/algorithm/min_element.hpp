@@ -20,6 +20,7 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/cpu_dispatch.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -31,10 +32,9 @@ namespace ranges
         /// @{
         struct min_element_fn
         {
-            template<typename I, typename S, typename C = ordered_less, typename P = ident,
-                CONCEPT_REQUIRES_(ForwardIterator<I>() && Sentinel<S, I>() &&
-                    IndirectRelation<C, projected<I, P>>())>
-            I operator()(I begin, S end, C pred = C{}, P proj = P{}) const
+        private:
+            template<typename I, typename S, typename C, typename P>
+            static I impl(I begin, S end, C &pred, P &proj, std::false_type)
             {
                 if(begin != end)
                     for(auto tmp = next(begin); tmp != end; ++tmp)
@@ -42,6 +42,33 @@ namespace ranges
                             begin = tmp;
                 return begin;
             }
+            // Contiguous integers: use the kernel for the processor.
+            template<typename I, typename C, typename P>
+            static I impl(I begin, I end, C &, P &, std::true_type)
+            {
+                return begin + (detail::simd_min_element(begin, end) - begin);
+            }
+            template<typename Rng, typename C, typename P>
+            static range_iterator_t<Rng> impl_rng(Rng &rng, C &pred, P &proj, std::false_type)
+            {
+                return min_element_fn::impl(begin(rng), end(rng), pred, proj, std::false_type{});
+            }
+            template<typename Rng, typename C, typename P>
+            static range_iterator_t<Rng> impl_rng(Rng &rng, C &, P &, std::true_type)
+            {
+                auto const first = data(rng);
+                auto const last = first + static_cast<std::ptrdiff_t>(size(rng));
+                return begin(rng) + (detail::simd_min_element(first, last) - first);
+            }
+        public:
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(ForwardIterator<I>() && Sentinel<S, I>() &&
+                    IndirectRelation<C, projected<I, P>>())>
+            I operator()(I begin, S end, C pred = C{}, P proj = P{}) const
+            {
+                return min_element_fn::impl(std::move(begin), std::move(end), pred, proj,
+                    meta::strict_and<detail::SimdSearchable<I, S, P>, detail::SimdLess<C>>{});
+            }
 
             template<typename Rng, typename C = ordered_less, typename P = ident,
                 typename I = range_iterator_t<Rng>,
@@ -49,7 +76,8 @@ namespace ranges
                     IndirectRelation<C, projected<I, P>>())>
             range_safe_iterator_t<Rng> operator()(Rng &&rng, C pred = C{}, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+                return min_element_fn::impl_rng(rng, pred, proj,
+                    meta::strict_and<detail::SimdSearchableRange<Rng, P>, detail::SimdLess<C>>{});
             }
         };
 
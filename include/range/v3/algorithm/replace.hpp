@@ -18,6 +18,9 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/data.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/utility/cpu_dispatch.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -38,15 +41,47 @@ namespace ranges
         /// @{
         struct replace_fn
         {
-            template<typename I, typename S, typename T0, typename T1, typename P = ident,
-                CONCEPT_REQUIRES_(Replaceable<I, T0, T1, P>() && Sentinel<S, I>())>
-            I operator()(I begin, S end, T0 const & old_value, T1 const & new_value, P proj = {}) const
+        private:
+            template<typename I, typename S, typename T0, typename T1, typename P>
+            static I impl(I begin, S end, T0 const & old_value, T1 const & new_value, P &proj,
+                std::false_type)
             {
                 for(; begin != end; ++begin)
                     if(invoke(proj, *begin) == old_value)
                         *begin = new_value;
                 return begin;
             }
+            // Contiguous arithmetic values: use the kernel for the processor.
+            template<typename I, typename T0, typename T1, typename P>
+            static I impl(I begin, I end, T0 const & old_value, T1 const & new_value, P &,
+                std::true_type)
+            {
+                detail::simd_replace(begin, end, old_value, new_value);
+                return end;
+            }
+            template<typename Rng, typename T0, typename T1, typename P>
+            static range_iterator_t<Rng> impl_rng(Rng &rng, T0 const & old_value,
+                T1 const & new_value, P &proj, std::false_type)
+            {
+                return replace_fn::impl(begin(rng), end(rng), old_value, new_value, proj,
+                    std::false_type{});
+            }
+            template<typename Rng, typename T0, typename T1, typename P>
+            static range_iterator_t<Rng> impl_rng(Rng &rng, T0 const & old_value,
+                T1 const & new_value, P &, std::true_type)
+            {
+                auto const n = static_cast<std::ptrdiff_t>(size(rng));
+                detail::simd_replace(data(rng), data(rng) + n, old_value, new_value);
+                return begin(rng) + n;
+            }
+        public:
+            template<typename I, typename S, typename T0, typename T1, typename P = ident,
+                CONCEPT_REQUIRES_(Replaceable<I, T0, T1, P>() && Sentinel<S, I>())>
+            I operator()(I begin, S end, T0 const & old_value, T1 const & new_value, P proj = {}) const
+            {
+                return replace_fn::impl(std::move(begin), std::move(end), old_value, new_value,
+                    proj, detail::SimdPermutable<I, S, P, T0, T1>{});
+            }
 
             template<typename Rng, typename T0, typename T1, typename P = ident,
                 typename I = range_iterator_t<Rng>,
@@ -54,7 +89,8 @@ namespace ranges
             range_safe_iterator_t<Rng>
             operator()(Rng &&rng, T0 const & old_value, T1 const & new_value, P proj = {}) const
             {
-                return (*this)(begin(rng), end(rng), old_value, new_value, std::move(proj));
+                return replace_fn::impl_rng(rng, old_value, new_value, proj,
+                    detail::SimdPermutableRange<Rng, P, T0, T1>{});
             }
         };
 
@@ -18,6 +18,9 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/data.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/utility/cpu_dispatch.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -38,15 +41,46 @@ namespace ranges
         /// @{
         struct replace_if_fn
         {
-            template<typename I, typename S, typename C, typename T, typename P = ident,
-                CONCEPT_REQUIRES_(ReplaceIfable<I, C, T, P>() && Sentinel<S, I>())>
-            I operator()(I begin, S end, C pred, T const & new_value, P proj = P{}) const
+        private:
+            template<typename I, typename S, typename C, typename T, typename P>
+            static I impl(I begin, S end, C &pred, T const & new_value, P &proj, std::false_type)
             {
                 for(; begin != end; ++begin)
                     if(invoke(pred, invoke(proj, *begin)))
                         *begin = new_value;
                 return begin;
             }
+            // Contiguous arithmetic values: use the kernel for the processor,
+            // which tests a vector's worth of elements before replacing them.
+            template<typename I, typename C, typename T, typename P>
+            static I impl(I begin, I end, C &pred, T const & new_value, P &, std::true_type)
+            {
+                detail::simd_replace_if(begin, end, pred, new_value);
+                return end;
+            }
+            template<typename Rng, typename C, typename T, typename P>
+            static range_iterator_t<Rng> impl_rng(Rng &rng, C &pred, T const & new_value,
+                P &proj, std::false_type)
+            {
+                return replace_if_fn::impl(begin(rng), end(rng), pred, new_value, proj,
+                    std::false_type{});
+            }
+            template<typename Rng, typename C, typename T, typename P>
+            static range_iterator_t<Rng> impl_rng(Rng &rng, C &pred, T const & new_value,
+                P &, std::true_type)
+            {
+                auto const n = static_cast<std::ptrdiff_t>(size(rng));
+                detail::simd_replace_if(data(rng), data(rng) + n, pred, new_value);
+                return begin(rng) + n;
+            }
+        public:
+            template<typename I, typename S, typename C, typename T, typename P = ident,
+                CONCEPT_REQUIRES_(ReplaceIfable<I, C, T, P>() && Sentinel<S, I>())>
+            I operator()(I begin, S end, C pred, T const & new_value, P proj = P{}) const
+            {
+                return replace_if_fn::impl(std::move(begin), std::move(end), pred, new_value,
+                    proj, detail::SimdPermutable<I, S, P, iterator_value_t<I>, T>{});
+            }
 
             template<typename Rng, typename C, typename T, typename P = ident,
                 typename I = range_iterator_t<Rng>,
@@ -54,7 +88,8 @@ namespace ranges
             range_safe_iterator_t<Rng>
             operator()(Rng &&rng, C pred, T const & new_value, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(pred), new_value, std::move(proj));
+                return replace_if_fn::impl_rng(rng, pred, new_value, proj,
+                    detail::SimdPermutableRange<Rng, P, range_value_t<Rng>, T>{});
             }
         };
 
@@ -17,6 +17,9 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/data.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/utility/cpu_dispatch.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
@@ -52,13 +55,40 @@ namespace ranges
                         ranges::iter_swap(begin, end);
             }
 
+            template<typename I>
+            static void impl(I begin, I end, std::false_type)
+            {
+                reverse_fn::impl(begin, end, iterator_concept<I>{});
+            }
+
+            // Contiguous arithmetic values: use the kernel for the processor.
+            template<typename I>
+            static void impl(I begin, I end, std::true_type)
+            {
+                detail::simd_reverse(begin, end);
+            }
+
+            template<typename Rng>
+            static range_iterator_t<Rng> impl_rng(Rng &rng, std::false_type)
+            {
+                return reverse_fn{}(begin(rng), end(rng));
+            }
+
+            template<typename Rng>
+            static range_iterator_t<Rng> impl_rng(Rng &rng, std::true_type)
+            {
+                auto const n = static_cast<std::ptrdiff_t>(size(rng));
+                detail::simd_reverse(data(rng), data(rng) + n);
+                return begin(rng) + n;
+            }
+
         public:
             template<typename I, typename S,
                 CONCEPT_REQUIRES_(BidirectionalIterator<I>() && Sentinel<S, I>() && Permutable<I>())>
             I operator()(I begin, S end_) const
             {
                 I end = ranges::next(begin, end_);
-                reverse_fn::impl(begin, end, iterator_concept<I>{});
+                reverse_fn::impl(begin, end, detail::SimdPermutable<I, I>{});
                 return end;
             }
 
@@ -66,7 +96,7 @@ namespace ranges
                 CONCEPT_REQUIRES_(BidirectionalRange<Rng>() && Permutable<I>())>
             range_safe_iterator_t<Rng> operator()(Rng &&rng) const
             {
-                return (*this)(begin(rng), end(rng));
+                return reverse_fn::impl_rng(rng, detail::SimdPermutableRange<Rng>{});
             }
         };
 
@@ -14,12 +14,15 @@
 #ifndef RANGES_V3_ALGORITHM_SAMPLE_HPP
 #define RANGES_V3_ALGORITHM_SAMPLE_HPP
 
+#include <cstdint>
 #include <utility>
+#include <vector>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/algorithm/min.hpp>
+#include <range/v3/algorithm/sort.hpp>
 #include <range/v3/utility/random.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
@@ -31,8 +34,81 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // Whether choosing k of n positions up front, which takes time and
+            // space proportional to k, beats visiting all n elements.
+            template<typename D>
+            bool sample_by_position(D n, D k)
+            {
+                return k <= n / 8;
+            }
+
+            // A set of positions with open addressing, sized for k of them.
+            template<typename D>
+            class position_set
+            {
+                std::vector<D> slots_;
+                unsigned shift_;
+            public:
+                explicit position_set(D k)
+                  : shift_(63)
+                {
+                    std::size_t size = 2;
+                    for(; size < 2 * static_cast<std::size_t>(k); size *= 2)
+                        --shift_;
+                    slots_.assign(size, D{-1});
+                }
+                // Inserts p unless it is already there, and says whether it
+                // was.
+                bool insert(D p)
+                {
+                    auto const mask = slots_.size() - 1;
+                    auto i = static_cast<std::size_t>(
+                        (static_cast<std::uint64_t>(p) * 0x9E3779B97F4A7C15u) >> shift_);
+                    for(; slots_[i] != D{-1}; i = (i + 1) & mask)
+                        if(slots_[i] == p)
+                            return false;
+                    slots_[i] = p;
+                    return true;
+                }
+            };
+
+            // k distinct positions in [0, n), each subset equally likely, in
+            // increasing order. Floyd's algorithm draws one number per
+            // position however large n is.
+            template<typename D, typename Gen>
+            std::vector<D> sample_positions(D n, D k, Gen &gen)
+            {
+                std::uniform_int_distribution<D> dist;
+                using param_t = typename decltype(dist)::param_type;
+                position_set<D> chosen{k};
+                std::vector<D> positions;
+                positions.reserve(static_cast<std::size_t>(k));
+                for(D j = n - k; j < n; ++j)
+                {
+                    D const t = dist(gen, param_t{0, j});
+                    // j is larger than all positions so far.
+                    if(chosen.insert(t))
+                        positions.push_back(t);
+                    else
+                    {
+                        chosen.insert(j);
+                        positions.push_back(j);
+                    }
+                }
+                ranges::sort(positions);
+                return positions;
+            }
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
+        /// A sample of at most an eighth of a random-access population is
+        /// chosen by position, which allocates two buffers of `n` positions.
+        /// Other samples are chosen in one pass without allocating.
         class sample_fn
         {
             template<typename I, typename S, typename O, typename Gen>
@@ -48,6 +124,34 @@ namespace ranges
             static tagged_pair<tag::in(I), tag::out(O)>
             sized_impl(I first, S last, iterator_difference_t<I> pop_size,
                 O out, iterator_difference_t<I> n, Gen && gen)
+            {
+                return sample_fn::sized_impl(std::move(first), std::move(last), pop_size,
+                    std::move(out), n, gen, RandomAccessIterator<I>{});
+            }
+            // Random access: a small sample is cheaper to pick by position
+            // than by visiting the whole population.
+            template<typename I, typename S, typename O, typename Gen>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            sized_impl(I first, S last, iterator_difference_t<I> pop_size,
+                O out, iterator_difference_t<I> n, Gen & gen, std::true_type)
+            {
+                n = ranges::min(pop_size, n);
+                if(n <= 0 || !detail::sample_by_position(pop_size, n))
+                    return sample_fn::sized_impl(std::move(first), std::move(last), pop_size,
+                        std::move(out), n, gen, std::false_type{});
+                auto const positions = detail::sample_positions(pop_size, n, gen);
+                for(auto const p : positions)
+                {
+                    *out = first[p];
+                    ++out;
+                }
+                first += positions.back() + 1;
+                return {std::move(first), std::move(out)};
+            }
+            template<typename I, typename S, typename O, typename Gen>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            sized_impl(I first, S last, iterator_difference_t<I> pop_size,
+                O out, iterator_difference_t<I> n, Gen & gen, std::false_type)
             {
                 std::uniform_int_distribution<iterator_difference_t<I>> dist;
                 using param_t = typename decltype(dist)::param_type;
@@ -24,10 +24,13 @@
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/data.hpp>
 #include <range/v3/empty.hpp>
 #include <range/v3/distance.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/utility/cpu_dispatch.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
@@ -119,6 +122,73 @@ namespace ranges
                     }
                 }
             }
+
+            // Contiguous integers: find each place the pattern can start with
+            // the kernel for the processor.
+            template<typename T, typename I2, typename S2>
+            static T *simd_impl(T *begin1, T *end1, I2 begin2, S2 end2)
+            {
+                auto const d2 = distance(begin2, end2);
+                if(end1 - begin1 < d2)
+                    return end1;
+                auto const head = *begin2;
+                ++begin2;
+                T *const last = end1 - (d2 - 1);
+                for(;; ++begin1)
+                {
+                    begin1 += detail::simd_find(begin1, last, head) - begin1;
+                    if(begin1 == last)
+                        return end1;
+                    auto m1 = begin1 + 1;
+                    auto m2 = begin2;
+                    for(; m2 != end2 && *m1 == *m2; ++m1, ++m2)
+                        ;
+                    if(m2 == end2)
+                        return begin1;
+                }
+            }
+
+            template<typename I1, typename S1, typename I2, typename S2, typename C,
+                typename P1, typename P2>
+            static I1 impl_iter(I1 begin1, S1 end1, I2 begin2, S2 end2, C &pred, P1 &proj1,
+                P2 &proj2, std::false_type)
+            {
+                if(SizedSentinel<S1, I1>() && SizedSentinel<S2, I2>())
+                    return search_fn::sized_impl(std::move(begin1), std::move(end1),
+                        distance(begin1, end1), std::move(begin2), std::move(end2),
+                        distance(begin2, end2), pred, proj1, proj2);
+                else
+                    return search_fn::impl(std::move(begin1), std::move(end1),
+                        std::move(begin2), std::move(end2), pred, proj1, proj2);
+            }
+            template<typename I1, typename I2, typename S2, typename C, typename P1,
+                typename P2>
+            static I1 impl_iter(I1 begin1, I1 end1, I2 begin2, S2 end2, C &, P1 &, P2 &,
+                std::true_type)
+            {
+                return search_fn::simd_impl(begin1, end1, std::move(begin2), std::move(end2));
+            }
+
+            template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+            static range_iterator_t<Rng1> impl_rng(Rng1 &rng1, Rng2 &rng2, C &pred,
+                P1 &proj1, P2 &proj2, std::false_type)
+            {
+                if(SizedRange<Rng1>() && SizedRange<Rng2>())
+                    return search_fn::sized_impl(begin(rng1), end(rng1), distance(rng1),
+                        begin(rng2), end(rng2), distance(rng2), pred, proj1, proj2);
+                else
+                    return search_fn::impl(begin(rng1), end(rng1),
+                        begin(rng2), end(rng2), pred, proj1, proj2);
+            }
+            template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+            static range_iterator_t<Rng1> impl_rng(Rng1 &rng1, Rng2 &rng2, C &, P1 &, P2 &,
+                std::true_type)
+            {
+                auto const first = data(rng1);
+                auto const last = first + static_cast<std::ptrdiff_t>(size(rng1));
+                return begin(rng1) + (search_fn::simd_impl(first, last, begin(rng2),
+                    end(rng2)) - first);
+            }
         public:
             template<typename I1, typename S1, typename I2, typename S2,
                 typename C = equal_to, typename P1 = ident, typename P2 = ident,
@@ -132,13 +202,9 @@ namespace ranges
             {
                 if(begin2 == end2)
                     return begin1;
-                if(SizedSentinel<S1, I1>() && SizedSentinel<S2, I2>())
-                    return search_fn::sized_impl(std::move(begin1), std::move(end1),
-                        distance(begin1, end1), std::move(begin2), std::move(end2),
-                        distance(begin2, end2), pred, proj1, proj2);
-                else
-                    return search_fn::impl(std::move(begin1), std::move(end1),
-                        std::move(begin2), std::move(end2), pred, proj1, proj2);
+                return search_fn::impl_iter(std::move(begin1), std::move(end1),
+                    std::move(begin2), std::move(end2), pred, proj1, proj2,
+                    detail::SimdComparable<I1, S1, I2, C, P1, P2>{});
             }
 
             template<typename Rng1, typename Rng2, typename C = equal_to, typename P1 = ident,
@@ -156,12 +222,8 @@ namespace ranges
             {
                 if(empty(rng2))
                     return begin(rng1);
-                if(SizedRange<Rng1>() && SizedRange<Rng2>())
-                    return search_fn::sized_impl(begin(rng1), end(rng1), distance(rng1),
-                        begin(rng2), end(rng2), distance(rng2), pred, proj1, proj2);
-                else
-                    return search_fn::impl(begin(rng1), end(rng1),
-                        begin(rng2), end(rng2), pred, proj1, proj2);
+                return search_fn::impl_rng(rng1, rng2, pred, proj1, proj2,
+                    detail::SimdComparableRange<Rng1, Rng2, C, P1, P2>{});
             }
         };
 
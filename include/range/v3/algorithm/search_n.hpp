@@ -24,10 +24,13 @@
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/data.hpp>
 #include <range/v3/empty.hpp>
 #include <range/v3/distance.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/utility/cpu_dispatch.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
@@ -116,6 +119,63 @@ namespace ranges
                     }
                 }
             }
+
+            // Contiguous integers: find each place a run can start with the
+            // kernel for the processor.
+            template<typename T, typename V>
+            static T *simd_impl(T *begin, T *end, std::ptrdiff_t count, V const &val)
+            {
+                while(true)
+                {
+                    begin += detail::simd_find(begin, end, val) - begin;
+                    if(end - begin < count)
+                        return end;
+                    T *m = begin + 1;
+                    T *const stop = begin + count;
+                    for(; m != stop && *m == val; ++m)
+                        ;
+                    if(m == stop)
+                        return begin;
+                    begin = m + 1;
+                }
+            }
+
+            template<typename I, typename S, typename V, typename C, typename P>
+            static I impl_iter(I begin, S end, iterator_difference_t<I> count, V const &val,
+                C &pred, P &proj, std::false_type)
+            {
+                if(SizedSentinel<S, I>())
+                    return search_n_fn::sized_impl(std::move(begin), std::move(end),
+                        distance(begin, end), count, val, pred, proj);
+                else
+                    return search_n_fn::impl(std::move(begin), std::move(end), count, val, pred,
+                        proj);
+            }
+            template<typename I, typename V, typename C, typename P>
+            static I impl_iter(I begin, I end, iterator_difference_t<I> count, V const &val,
+                C &, P &, std::true_type)
+            {
+                return search_n_fn::simd_impl(begin, end, count, val);
+            }
+
+            template<typename Rng, typename V, typename C, typename P>
+            static range_iterator_t<Rng> impl_rng(Rng &rng, range_difference_t<Rng> count,
+                V const &val, C &pred, P &proj, std::false_type)
+            {
+                if(SizedRange<Rng>())
+                    return search_n_fn::sized_impl(begin(rng), end(rng), distance(rng), count, val,
+                        pred, proj);
+                else
+                    return search_n_fn::impl(begin(rng), end(rng), count, val, pred, proj);
+            }
+            template<typename Rng, typename V, typename C, typename P>
+            static range_iterator_t<Rng> impl_rng(Rng &rng, range_difference_t<Rng> count,
+                V const &val, C &, P &, std::true_type)
+            {
+                auto const first = data(rng);
+                auto const last = first + static_cast<std::ptrdiff_t>(size(rng));
+                return begin(rng) + (search_n_fn::simd_impl(first, last, count, val) - first);
+            }
         public:
             template<typename I, typename S, typename V, typename C = equal_to, typename P = ident,
                 CONCEPT_REQUIRES_(Searchnable<I, V, C, P>() && Sentinel<S, I>())>
@@ -124,12 +184,9 @@ namespace ranges
             {
                 if(count <= 0)
                     return begin;
-                if(SizedSentinel<S, I>())
-                    return search_n_fn::sized_impl(std::move(begin), std::move(end),
-                        distance(begin, end), count, val, pred, proj);
-                else
-                    return search_n_fn::impl(std::move(begin), std::move(end), count, val, pred,
-                        proj);
+                return search_n_fn::impl_iter(std::move(begin), std::move(end), count, val,
+                    pred, proj, meta::strict_and<std::is_same<C, equal_to>,
+                        detail::SimdSearchable<I, S, P, V>>{});
             }
 
             template<typename Rng, typename V, typename C = equal_to, typename P = ident,
@@ -141,11 +198,9 @@ namespace ranges
             {
                 if(count <= 0)
                     return begin(rng);
-                if(SizedRange<Rng>())
-                    return search_n_fn::sized_impl(begin(rng), end(rng), distance(rng), count, val,
-                        pred, proj);
-                else
-                    return search_n_fn::impl(begin(rng), end(rng), count, val, pred, proj);
+                return search_n_fn::impl_rng(rng, count, val, pred, proj,
+                    meta::strict_and<std::is_same<C, equal_to>,
+                        detail::SimdSearchableRange<Rng, P, V>>{});
             }
         };
 
@@ -28,6 +28,7 @@
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/algorithm/copy.hpp>
@@ -81,6 +82,22 @@ namespace ranges
 
         struct set_union_fn
         {
+        private:
+            // The union is at least as long as the longer range.
+            template<typename O, typename I1, typename S1, typename I2, typename S2,
+                CONCEPT_REQUIRES_(SizedSentinel<S1, I1>() && SizedSentinel<S2, I2>())>
+            static void reserve_output(O &out, I1 const &begin1, S1 const &end1,
+                I2 const &begin2, S2 const &end2)
+            {
+                auto const n1 = static_cast<std::ptrdiff_t>(end1 - begin1);
+                auto const n2 = static_cast<std::ptrdiff_t>(end2 - begin2);
+                detail::reserve_output(out, n1 < n2 ? n2 : n1);
+            }
+            template<typename O, typename I1, typename S1, typename I2, typename S2,
+                CONCEPT_REQUIRES_(!(SizedSentinel<S1, I1>() && SizedSentinel<S2, I2>()))>
+            static void reserve_output(O &, I1 const &, S1 const &, I2 const &, S2 const &)
+            {}
+        public:
             template<typename I1, typename S1, typename I2, typename S2, typename O,
                 typename C = ordered_less, typename P1 = ident, typename P2 = ident,
                 CONCEPT_REQUIRES_(Mergeable<I1, I2, O, C, P1, P2>() &&
@@ -89,6 +106,7 @@ namespace ranges
             operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
                 C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
             {
+                set_union_fn::reserve_output(out, begin1, end1, begin2, end2);
                 for(; begin1 != end1; ++out)
                 {
                     if(begin2 == end2)
@@ -0,0 +1,290 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_SORT_RESUMABLE_HPP
+#define RANGES_V3_ALGORITHM_SORT_RESUMABLE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/work_budget.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// The state of a stable sort that runs a budgeted slice of the work at
+        /// a time. The sort is a bottom-up merge sort: short runs are first
+        /// insertion sorted in place, then merged in passes that alternate
+        /// between the range and a buffer. All of its progress is kept as
+        /// indices, so it can suspend after any element. While a merge pass is
+        /// under way some elements live only in the buffer, so the range should
+        /// not be read until the sort is done or cancelled.
+        template<typename I, typename C, typename P>
+        struct sort_resumable_state
+        {
+        private:
+            using D = iterator_difference_t<I>;
+            using V = iterator_value_t<I>;
+            static constexpr D run_size = 32;
+            enum class phase
+            {
+                runs, merge, copy_back, done
+            };
+
+            I begin_;
+            D size_;
+            C pred_;
+            P proj_;
+            std::vector<V> buf_;
+            phase phase_;
+            resumable_status status_;
+            // runs and copy_back: the next element to process.
+            D pos_;
+            // merge: the width of the runs being merged, the start of the pair
+            // of runs being merged, the next element of each run, and the next
+            // output element. in_buf_ is true when the buffer is the source.
+            D width_, lo_, i_, j_, k_;
+            bool in_buf_;
+
+            V &buf_at(D i)
+            {
+                return buf_[static_cast<std::size_t>(i)];
+            }
+            void put(D k, V &&v)
+            {
+                // The buffer is filled in order on the first pass.
+                if(!in_buf_ && static_cast<std::size_t>(k) == buf_.size())
+                    buf_.push_back(std::move(v));
+                else if(!in_buf_)
+                    buf_at(k) = std::move(v);
+                else
+                    *(begin_ + k) = std::move(v);
+            }
+            V take(D i)
+            {
+                return in_buf_ ? std::move(buf_at(i)) : iter_move(begin_ + i);
+            }
+            bool before(D j, D i)
+            {
+                return in_buf_ ?
+                    invoke(pred_, invoke(proj_, buf_at(j)), invoke(proj_, buf_at(i))) :
+                    invoke(pred_, invoke(proj_, *(begin_ + j)), invoke(proj_, *(begin_ + i)));
+            }
+            void insertion_sort(I first, I last)
+            {
+                if(first == last)
+                    return;
+                for(I i = next(first); i != last; ++i)
+                {
+                    V v = iter_move(i);
+                    I j = i;
+                    for(; j != first && invoke(pred_, invoke(proj_, v), invoke(proj_, *prev(j))); --j)
+                        *j = iter_move(prev(j));
+                    *j = std::move(v);
+                }
+            }
+            void start_pair()
+            {
+                i_ = k_ = lo_;
+                j_ = (std::min)(lo_ + width_, size_);
+            }
+            bool sort_runs(detail::budget_meter &meter)
+            {
+                for(; pos_ < size_; pos_ += run_size)
+                {
+                    D const len = (std::min)(run_size, size_ - pos_);
+                    if(!meter.spend(len))
+                        return false;
+                    insertion_sort(begin_ + pos_, begin_ + (pos_ + len));
+                }
+                return true;
+            }
+            bool merge(detail::budget_meter &meter)
+            {
+                while(width_ < size_)
+                {
+                    D const mid = (std::min)(lo_ + width_, size_);
+                    D const hi = (std::min)(lo_ + 2 * width_, size_);
+                    for(; k_ < hi; ++k_)
+                    {
+                        if(!meter.spend())
+                            return false;
+                        if(i_ == mid || (j_ != hi && before(j_, i_)))
+                            put(k_, take(j_++));
+                        else
+                            put(k_, take(i_++));
+                    }
+                    lo_ = hi;
+                    if(lo_ == size_)
+                    {
+                        width_ *= 2;
+                        lo_ = 0;
+                        in_buf_ = !in_buf_;
+                    }
+                    start_pair();
+                }
+                return true;
+            }
+            // Moves the elements that live only in the buffer back into the
+            // slots of the range that they left, in no particular order.
+            void restore()
+            {
+                D const mid = (std::min)(lo_ + width_, size_);
+                if(phase_ == phase::merge && !in_buf_)
+                {
+                    // This pass has merged the elements before i_ and those
+                    // from mid to j_ into the start of the buffer.
+                    D t = 0;
+                    for(D i = 0; i != i_; ++i)
+                        *(begin_ + i) = std::move(buf_at(t++));
+                    for(D i = mid; i != j_; ++i)
+                        *(begin_ + i) = std::move(buf_at(t++));
+                }
+                else if(phase_ == phase::merge)
+                {
+                    // The range holds the merged elements before k_, and the
+                    // buffer those that have not been merged yet.
+                    D k = k_;
+                    for(D i = i_; i != mid; ++i)
+                        *(begin_ + k++) = std::move(buf_at(i));
+                    for(D i = j_; i != size_; ++i)
+                        *(begin_ + k++) = std::move(buf_at(i));
+                }
+                else if(phase_ == phase::copy_back && in_buf_)
+                {
+                    for(D i = pos_; i != size_; ++i)
+                        *(begin_ + i) = std::move(buf_at(i));
+                }
+                std::vector<V>().swap(buf_);
+            }
+            resumable_status stop(detail::budget_meter const &meter)
+            {
+                status_ = meter.stopped();
+                if(status_ == resumable_status::cancelled)
+                    restore();
+                return status_;
+            }
+            bool copy_back(detail::budget_meter &meter)
+            {
+                if(in_buf_)
+                {
+                    for(; pos_ < size_; ++pos_)
+                    {
+                        if(!meter.spend())
+                            return false;
+                        *(begin_ + pos_) = std::move(buf_at(pos_));
+                    }
+                }
+                std::vector<V>().swap(buf_);
+                return true;
+            }
+        public:
+            sort_resumable_state(I begin, D size, C pred, P proj)
+              : begin_(std::move(begin)), size_(size), pred_(std::move(pred))
+              , proj_(std::move(proj)), buf_(), phase_(phase::runs)
+              , status_(resumable_status::suspended), pos_(0), width_(run_size)
+              , lo_(0), i_(0), j_(0), k_(0), in_buf_(false)
+            {
+                start_pair();
+            }
+            /// Sorts until the range is sorted, `budget` is spent, or `token`
+            /// is cancelled. A cancelled sort moves any elements held in its
+            /// buffer back, leaving the range an unsorted permutation of its
+            /// input. Once the sort is done or cancelled, further calls do
+            /// nothing.
+            resumable_status resume(work_budget const &budget,
+                cancellation_token const &token = cancellation_token{})
+            {
+                if(status_ != resumable_status::suspended)
+                    return status_;
+                detail::budget_meter meter{budget, token};
+                if(phase_ == phase::runs)
+                {
+                    if(!sort_runs(meter))
+                        return stop(meter);
+                    phase_ = phase::merge;
+                    if(width_ < size_)
+                        buf_.reserve(static_cast<std::size_t>(size_));
+                }
+                if(phase_ == phase::merge)
+                {
+                    if(!merge(meter))
+                        return stop(meter);
+                    phase_ = phase::copy_back;
+                    pos_ = 0;
+                }
+                if(phase_ == phase::copy_back)
+                {
+                    if(!copy_back(meter))
+                        return stop(meter);
+                    phase_ = phase::done;
+                }
+                return status_ = resumable_status::done;
+            }
+            resumable_status status() const
+            {
+                return status_;
+            }
+            bool done() const
+            {
+                return status_ == resumable_status::done;
+            }
+        };
+
+        template<typename I, typename C, typename P>
+        constexpr iterator_difference_t<I> sort_resumable_state<I, C, P>::run_size;
+
+        struct sort_resumable_fn
+        {
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterator<I>() &&
+                    Sentinel<S, I>())>
+            sort_resumable_state<I, C, P>
+            operator()(I begin, S end, C pred = C{}, P proj = P{}) const
+            {
+                auto const size = distance(begin, end);
+                return {std::move(begin), size, std::move(pred), std::move(proj)};
+            }
+
+            /// \pre The range must outlive the returned state.
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessRange<Rng>())>
+            sort_resumable_state<I, C, P>
+            operator()(Rng &rng, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
+        };
+
+        /// \sa `sort_resumable_fn`
+        /// \ingroup group-algorithms
+        RANGES_INLINE_VARIABLE(sort_resumable_fn, sort_resumable)
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
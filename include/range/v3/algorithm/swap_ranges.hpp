@@ -17,6 +17,9 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/data.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/utility/cpu_dispatch.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -31,15 +34,71 @@ namespace ranges
         /// @{
         struct swap_ranges_fn
         {
+        private:
+            template<typename I1, typename S1, typename I2>
+            static tagged_pair<tag::in1(I1), tag::in2(I2)>
+            impl(I1 begin1, S1 end1, I2 begin2, std::false_type)
+            {
+                for(; begin1 != end1; ++begin1, ++begin2)
+                    ranges::iter_swap(begin1, begin2);
+                return {begin1, begin2};
+            }
+            // Contiguous arithmetic values: use the kernel for the processor.
+            template<typename I>
+            static tagged_pair<tag::in1(I), tag::in2(I)>
+            impl(I begin1, I end1, I begin2, std::true_type)
+            {
+                detail::simd_swap_ranges(begin1, end1, begin2);
+                return {end1, begin2 + (end1 - begin1)};
+            }
+            template<typename I1, typename S1, typename I2, typename S2>
+            static tagged_pair<tag::in1(I1), tag::in2(I2)>
+            impl(I1 begin1, S1 end1, I2 begin2, S2 end2, std::false_type)
+            {
+                for(; begin1 != end1 && begin2 != end2; ++begin1, ++begin2)
+                    ranges::iter_swap(begin1, begin2);
+                return {begin1, begin2};
+            }
+            template<typename I>
+            static tagged_pair<tag::in1(I), tag::in2(I)>
+            impl(I begin1, I end1, I begin2, I end2, std::true_type)
+            {
+                auto const n = (end1 - begin1) < (end2 - begin2) ?
+                    (end1 - begin1) : (end2 - begin2);
+                detail::simd_swap_ranges(begin1, begin1 + n, begin2);
+                return {begin1 + n, begin2 + n};
+            }
+            template<typename Rng1, typename Rng2>
+            static tagged_pair<
+                tag::in1(range_iterator_t<Rng1>),
+                tag::in2(range_iterator_t<Rng2>)>
+            impl_rng(Rng1 &rng1, Rng2 &rng2, std::false_type)
+            {
+                return swap_ranges_fn::impl(begin(rng1), end(rng1), begin(rng2), end(rng2),
+                    std::false_type{});
+            }
+            template<typename Rng1, typename Rng2>
+            static tagged_pair<
+                tag::in1(range_iterator_t<Rng1>),
+                tag::in2(range_iterator_t<Rng2>)>
+            impl_rng(Rng1 &rng1, Rng2 &rng2, std::true_type)
+            {
+                auto const n1 = static_cast<std::ptrdiff_t>(size(rng1));
+                auto const n2 = static_cast<std::ptrdiff_t>(size(rng2));
+                auto const n = n1 < n2 ? n1 : n2;
+                detail::simd_swap_ranges(data(rng1), data(rng1) + n, data(rng2));
+                return {begin(rng1) + n, begin(rng2) + n};
+            }
+        public:
             template<typename I1, typename S1, typename I2,
                 CONCEPT_REQUIRES_(InputIterator<I1>() && Sentinel<S1, I1>() &&
                     InputIterator<I2>() && IndirectlySwappable<I1, I2>())>
             tagged_pair<tag::in1(I1), tag::in2(I2)>
             operator()(I1 begin1, S1 end1, I2 begin2) const
             {
-                for(; begin1 != end1; ++begin1, ++begin2)
-                    ranges::iter_swap(begin1, begin2);
-                return {begin1, begin2};
+                return swap_ranges_fn::impl(std::move(begin1), std::move(end1),
+                    std::move(begin2), meta::strict_and<detail::SimdPermutable<I1, S1>,
+                        std::is_same<I1, I2>>{});
             }
 
             template<typename I1, typename S1, typename I2, typename S2,
@@ -49,9 +108,10 @@ namespace ranges
             tagged_pair<tag::in1(I1), tag::in2(I2)>
             operator()(I1 begin1, S1 end1, I2 begin2, S2 end2) const
             {
-                for(; begin1 != end1 && begin2 != end2; ++begin1, ++begin2)
-                    ranges::iter_swap(begin1, begin2);
-                return {begin1, begin2};
+                return swap_ranges_fn::impl(std::move(begin1), std::move(end1),
+                    std::move(begin2), std::move(end2),
+                    meta::strict_and<detail::SimdPermutable<I1, S1>,
+                        detail::SimdPermutable<I2, S2>, std::is_same<I1, I2>>{});
             }
 
             template<typename Rng1, typename I2_,
@@ -75,7 +135,10 @@ namespace ranges
                 tag::in2(range_safe_iterator_t<Rng2>)>
             operator()(Rng1 && rng1, Rng2 && rng2) const
             {
-                return (*this)(begin(rng1), end(rng1), begin(rng2), end(rng2));
+                return swap_ranges_fn::impl_rng(rng1, rng2,
+                    meta::strict_and<detail::SimdPermutableRange<Rng1>,
+                        detail::SimdPermutableRange<Rng2>,
+                        std::is_same<range_reference_t<Rng1>, range_reference_t<Rng2>>>{});
             }
         };
 
@@ -13,16 +13,22 @@
 #ifndef RANGES_V3_ALGORITHM_TRANSFORM_HPP
 #define RANGES_V3_ALGORITHM_TRANSFORM_HPP
 
+#include <memory>
 #include <tuple>
 #include <utility>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/data.hpp>
+#include <range/v3/size.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/utility/cpu_dispatch.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/nontemporal.hpp>
 #include <range/v3/utility/unreachable.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/tagged_pair.hpp>
@@ -55,15 +61,164 @@ namespace ranges
         /// @{
         struct transform_fn
         {
+        private:
+            template<typename I, typename S, typename O, typename F, typename P>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(I begin, S end, O out, F &fun, P &proj, std::false_type)
+            {
+                detail::reserve_output(out, begin, end);
+                for(; begin != end; ++begin, ++out)
+                    *out = invoke(fun, invoke(proj, *begin));
+                return {begin, out};
+            }
+            // A known number of trivial values appended to a container: grow
+            // it first and write the values in place.
+            template<typename I, typename S, typename O, typename F, typename P>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(I begin, S end, O out, F &fun, P &proj, std::true_type)
+            {
+                auto it = detail::grow_back(out, static_cast<std::size_t>(end - begin));
+                try
+                {
+                    for(; begin != end; ++begin, ++it)
+                        *it = invoke(fun, invoke(proj, *begin));
+                }
+                catch(...)
+                {
+                    detail::shrink_back(out, it);
+                    throw;
+                }
+                return {begin, out};
+            }
+            template<typename I, typename S, typename O, typename F, typename P>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl_simd(I begin, S end, O out, F &fun, P &proj, std::false_type)
+            {
+                return transform_fn::impl(std::move(begin), std::move(end), std::move(out),
+                    fun, proj, meta::strict_and<SizedSentinel<S, I>,
+                        detail::back_insert_growable<O>>{});
+            }
+            // Contiguous arithmetic values written to an array: use the
+            // kernels for the processor.
+            template<typename I, typename O, typename F, typename P>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl_simd(I begin, I end, O out, F &fun, P &, std::true_type)
+            {
+                return {end, detail::simd_transform(begin, end, out, fun)};
+            }
+            // The array behind an output iterator that is known to be
+            // contiguous.
+            template<typename T>
+            static T *address(T *out)
+            {
+                return out;
+            }
+            template<typename O>
+            static meta::_t<std::remove_reference<iterator_reference_t<O>>> *address(O out)
+            {
+                return std::addressof(*out);
+            }
+            template<typename Rng, typename O, typename F, typename P>
+            static tagged_pair<tag::in(range_iterator_t<Rng>), tag::out(O)>
+            impl_rng(Rng &rng, O out, F &fun, P &proj, std::false_type)
+            {
+                return transform_fn::impl_simd(begin(rng), end(rng), std::move(out), fun, proj,
+                    std::false_type{});
+            }
+            template<typename Rng, typename O, typename F, typename P>
+            static tagged_pair<tag::in(range_iterator_t<Rng>), tag::out(O)>
+            impl_rng(Rng &rng, O out, F &fun, P &, std::true_type)
+            {
+                auto const n = static_cast<std::ptrdiff_t>(size(rng));
+                if(n != 0)
+                    detail::simd_transform(data(rng), data(rng) + n, transform_fn::address(out),
+                        fun);
+                return {begin(rng) + n, out + n};
+            }
+            // Room for the shorter of two sized ranges.
+            template<typename O, typename I0, typename S0, typename I1, typename S1,
+                CONCEPT_REQUIRES_(SizedSentinel<S0, I0>() && SizedSentinel<S1, I1>())>
+            static void reserve_output2(O &out, I0 const &begin0, S0 const &end0,
+                I1 const &begin1, S1 const &end1)
+            {
+                auto const n0 = static_cast<std::ptrdiff_t>(end0 - begin0);
+                auto const n1 = static_cast<std::ptrdiff_t>(end1 - begin1);
+                detail::reserve_output(out, n0 < n1 ? n0 : n1);
+            }
+            template<typename O, typename I0, typename S0, typename I1, typename S1,
+                CONCEPT_REQUIRES_(!(SizedSentinel<S0, I0>() && SizedSentinel<S1, I1>()))>
+            static void reserve_output2(O &, I0 const &, S0 const &, I1 const &, S1 const &)
+            {}
+            template<typename I0, typename S0, typename I1, typename S1, typename O, typename F,
+                typename P0, typename P1>
+            static tagged_tuple<tag::in1(I0), tag::in2(I1), tag::out(O)>
+            impl2(I0 begin0, S0 end0, I1 begin1, S1 end1, O out, F &fun, P0 &proj0, P1 &proj1,
+                std::false_type)
+            {
+                transform_fn::reserve_output2(out, begin0, end0, begin1, end1);
+                for(; begin0 != end0 && begin1 != end1; ++begin0, ++begin1, ++out)
+                    *out = invoke(fun, invoke(proj0, *begin0), invoke(proj1, *begin1));
+                return tagged_tuple<tag::in1(I0), tag::in2(I1), tag::out(O)>{begin0, begin1, out};
+            }
+            // Contiguous arithmetic values written to an array: use the
+            // kernels for the processor.
+            template<typename I0, typename I1, typename S1, typename O, typename F,
+                typename P0, typename P1>
+            static tagged_tuple<tag::in1(I0), tag::in2(I1), tag::out(O)>
+            impl2(I0 begin0, I0 end0, I1 begin1, S1 end1, O out, F &fun, P0 &, P1 &,
+                std::true_type)
+            {
+                auto const n = transform_fn::min_size(end0 - begin0, begin1, end1);
+                out = detail::simd_transform2(begin0, begin0 + n, begin1, out, fun);
+                return tagged_tuple<tag::in1(I0), tag::in2(I1), tag::out(O)>{
+                    begin0 + n, begin1 + n, out};
+            }
+            template<typename I1>
+            static std::ptrdiff_t min_size(std::ptrdiff_t n0, I1 const &begin1, I1 const &end1)
+            {
+                return n0 < end1 - begin1 ? n0 : end1 - begin1;
+            }
+            template<typename I1>
+            static std::ptrdiff_t min_size(std::ptrdiff_t n0, I1 const &, unreachable)
+            {
+                return n0;
+            }
+            template<typename Rng0, typename Rng1, typename O, typename F, typename P0,
+                typename P1>
+            static tagged_tuple<tag::in1(range_iterator_t<Rng0>),
+                tag::in2(range_iterator_t<Rng1>), tag::out(O)>
+            impl2_rng(Rng0 &rng0, Rng1 &rng1, O out, F &fun, P0 &proj0, P1 &proj1,
+                std::false_type)
+            {
+                return transform_fn::impl2(begin(rng0), end(rng0), begin(rng1), end(rng1),
+                    std::move(out), fun, proj0, proj1, std::false_type{});
+            }
+            template<typename Rng0, typename Rng1, typename O, typename F, typename P0,
+                typename P1>
+            static tagged_tuple<tag::in1(range_iterator_t<Rng0>),
+                tag::in2(range_iterator_t<Rng1>), tag::out(O)>
+            impl2_rng(Rng0 &rng0, Rng1 &rng1, O out, F &fun, P0 &, P1 &, std::true_type)
+            {
+                auto const n0 = static_cast<std::ptrdiff_t>(size(rng0));
+                auto const n1 = static_cast<std::ptrdiff_t>(size(rng1));
+                auto const n = n0 < n1 ? n0 : n1;
+                if(n != 0)
+                    detail::simd_transform2(data(rng0), data(rng0) + n, data(rng1),
+                        transform_fn::address(out), fun);
+                return tagged_tuple<tag::in1(range_iterator_t<Rng0>),
+                    tag::in2(range_iterator_t<Rng1>), tag::out(O)>{
+                        begin(rng0) + n, begin(rng1) + n, out + n};
+            }
+        public:
             // Single-range variant
             template<typename I, typename S, typename O, typename F, typename P = ident,
                 CONCEPT_REQUIRES_(Sentinel<S, I>() && Transformable1<I, O, F, P>())>
             tagged_pair<tag::in(I), tag::out(O)>
             operator()(I begin, S end, O out, F fun, P proj = P{}) const
             {
-                for(; begin != end; ++begin, ++out)
-                    *out = invoke(fun, invoke(proj, *begin));
-                return {begin, out};
+                return transform_fn::impl_simd(std::move(begin), std::move(end), std::move(out),
+                    fun, proj, meta::strict_and<std::is_same<P, ident>,
+                        detail::SimdTransformable<O, I, S>>{});
             }
 
             template<typename Rng, typename O, typename F, typename P = ident,
@@ -72,7 +227,43 @@ namespace ranges
             tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
             operator()(Rng &&rng, O out, F fun, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(out), std::move(fun), std::move(proj));
+                return transform_fn::impl_rng(rng, std::move(out), fun, proj,
+                    detail::SimdTransformableRange<O, Rng, P>{});
+            }
+
+            /// \overload
+            /// Writes a destination of at least `nt.threshold()` bytes with
+            /// streaming stores.
+            template<typename I, typename S, typename T, typename F,
+                CONCEPT_REQUIRES_(SizedSentinel<S, I>() && Transformable1<I, T *, F>() &&
+                    detail::NontemporalOutput<T *>())>
+            tagged_pair<tag::in(I), tag::out(T *)>
+            operator()(I begin, S end, T *out, F fun, nontemporal_t nt) const
+            {
+                auto const n = static_cast<std::size_t>(end - begin);
+                if(n * sizeof(T) < nt.threshold())
+                    return (*this)(std::move(begin), std::move(end), out, std::move(fun));
+                detail::nontemporal_writer<T> w{out};
+                for(; begin != end; ++begin)
+                    w.push(invoke(fun, *begin));
+                return {begin, w.finish()};
+            }
+
+            /// \overload
+            template<typename Rng, typename T, typename F,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(SizedRange<Rng>() && Transformable1<I, T *, F>() &&
+                    detail::NontemporalOutput<T *>())>
+            tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(T *)>
+            operator()(Rng &&rng, T *out, F fun, nontemporal_t nt) const
+            {
+                if(static_cast<std::size_t>(size(rng)) * sizeof(T) < nt.threshold())
+                    return (*this)(begin(rng), end(rng), out, std::move(fun));
+                detail::nontemporal_writer<T> w{out};
+                auto it = begin(rng);
+                for(auto const e = end(rng); it != e; ++it)
+                    w.push(invoke(fun, *it));
+                return {it, w.finish()};
             }
 
             // Double-range variant, 4-iterator version
@@ -84,9 +275,11 @@ namespace ranges
             operator()(I0 begin0, S0 end0, I1 begin1, S1 end1, O out, F fun,
                 P0 proj0 = P0{}, P1 proj1 = P1{}) const
             {
-                for(; begin0 != end0 && begin1 != end1; ++begin0, ++begin1, ++out)
-                    *out = invoke(fun, invoke(proj0, *begin0), invoke(proj1, *begin1));
-                return tagged_tuple<tag::in1(I0), tag::in2(I1), tag::out(O)>{begin0, begin1, out};
+                return transform_fn::impl2(std::move(begin0), std::move(end0), std::move(begin1),
+                    std::move(end1), std::move(out), fun, proj0, proj1,
+                    meta::strict_and<std::is_same<P0, ident>, std::is_same<P1, ident>,
+                        meta::or_<std::is_same<I1, S1>, std::is_same<S1, unreachable>>,
+                        detail::SimdTransformable<O, I0, S0, I1>>{});
             }
 
             template<typename Rng0, typename Rng1, typename O, typename F,
@@ -99,8 +292,9 @@ namespace ranges
             operator()(Rng0 &&rng0, Rng1 &&rng1, O out, F fun, P0 proj0 = P0{},
                 P1 proj1 = P1{}) const
             {
-                return (*this)(begin(rng0), end(rng0), begin(rng1), end(rng1), std::move(out),
-                    std::move(fun), std::move(proj0), std::move(proj1));
+                return transform_fn::impl2_rng(rng0, rng1, std::move(out), fun, proj0, proj1,
+                    meta::strict_and<detail::SimdTransformableRange<O, Rng0, P0>,
+                        detail::SimdArithmeticRange<Rng1, P1>>{});
             }
 
             // Double-range variant, 3-iterator version
@@ -112,6 +306,7 @@ namespace ranges
             operator()(I0 begin0, S0 end0, I1 begin1, O out, F fun, P0 proj0 = P0{},
                 P1 proj1 = P1{}) const
             {
+                detail::reserve_output(out, begin0, end0);
                 return (*this)(std::move(begin0), std::move(end0), std::move(begin1), unreachable{},
                     std::move(out), std::move(fun), std::move(proj0), std::move(proj1));
             }
@@ -0,0 +1,113 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_TRANSPOSE_HPP
+#define RANGES_V3_ALGORITHM_TRANSPOSE_HPP
+
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/tagged_pair.hpp>
+#include <range/v3/algorithm/tagspec.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-algorithms
+        /// @{
+        struct transpose_fn
+        {
+        private:
+            // Blocks this small fit comfortably in L1 for any reasonable element type.
+            static constexpr std::ptrdiff_t block_size_ = 16;
+
+            // Cache-oblivious transposition: split the longer side of the
+            // [row_begin, row_end) x [col_begin, col_end) block in half until both
+            // sides are small, then copy the block directly. Element (r, c) of the
+            // source lives at src[r * width + c] and goes to dst[c * height + r].
+            template<typename I, typename O, typename D>
+            static void impl(I src, O dst, D width, D height,
+                D row_begin, D row_end, D col_begin, D col_end)
+            {
+                while(true)
+                {
+                    D const rows = row_end - row_begin, cols = col_end - col_begin;
+                    if(rows <= block_size_ && cols <= block_size_)
+                    {
+                        for(D r = row_begin; r != row_end; ++r)
+                        {
+                            I in = src + (r * width + col_begin);
+                            for(D c = col_begin; c != col_end; ++c, ++in)
+                                *(dst + (c * height + r)) = *in;
+                        }
+                        return;
+                    }
+                    if(rows >= cols)
+                    {
+                        D const mid = row_begin + rows / 2;
+                        transpose_fn::impl(src, dst, width, height,
+                            row_begin, mid, col_begin, col_end);
+                        row_begin = mid;
+                    }
+                    else
+                    {
+                        D const mid = col_begin + cols / 2;
+                        transpose_fn::impl(src, dst, width, height,
+                            row_begin, row_end, col_begin, mid);
+                        col_begin = mid;
+                    }
+                }
+            }
+        public:
+            /// Copies the `height` x `width` row-major matrix at the front of `rng`
+            /// to the `width` x `height` row-major matrix at the front of `out`, so
+            /// that element `(r, c)` of the source becomes element `(c, r)` of the
+            /// destination. The source and destination must not overlap.
+            template<typename Rng, typename ORng,
+                typename I = range_iterator_t<Rng>,
+                typename O = range_iterator_t<ORng>,
+                CONCEPT_REQUIRES_(
+                    RandomAccessRange<Rng>() &&
+                    RandomAccessRange<ORng>() &&
+                    IndirectlyCopyable<I, O>()
+                )>
+            tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(range_safe_iterator_t<ORng>)>
+            operator()(Rng &&rng, ORng &&out, range_difference_t<Rng> width,
+                range_difference_t<Rng> height) const
+            {
+                using D = range_difference_t<Rng>;
+                RANGES_EXPECT(0 <= width && 0 <= height);
+                RANGES_EXPECT(width * height <= distance(rng));
+                RANGES_EXPECT(width * height <= distance(out));
+                auto const first = begin(rng);
+                auto const result = begin(out);
+                if(0 != width && 0 != height)
+                    transpose_fn::impl(first, result, width, height, D{0}, height, D{0}, width);
+                auto const n = width * height;
+                return {first + n, result + static_cast<range_difference_t<ORng>>(n)};
+            }
+        };
+
+        /// \sa `transpose_fn`
+        /// \ingroup group-algorithms
+        RANGES_INLINE_VARIABLE(transpose_fn, transpose)
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
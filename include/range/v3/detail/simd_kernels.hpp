@@ -0,0 +1,381 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// No include guard: utility/cpu_dispatch.hpp includes this file once per
+// instruction set, inside a `#pragma GCC target` region, after defining
+//  - RANGES_SIMD_NS: the namespace to put the kernels in
+//  - RANGES_SIMD_BYTES: the vector width in bytes (16, 32 or 64)
+//  - RANGES_SIMD_ANY(m): whether any lane of the mask vector m is set
+//  - RANGES_SIMD_SHUFFLE_BYTES(t, i): the bytes of t picked by the indices
+//    in i within each 16-byte lane, or zero where an index has its top bit
+//    set (pshufb)
+// The kernels are written once with vector extensions and compiled for each
+// instruction set.
+
+namespace RANGES_SIMD_NS
+{
+    template<typename T>
+    struct simd
+    {
+        typedef T vec __attribute__((vector_size(RANGES_SIMD_BYTES)));
+        static constexpr std::ptrdiff_t lanes = RANGES_SIMD_BYTES / sizeof(T);
+
+        typedef decltype(vec{} == vec{}) mask;
+
+        static vec load(T const *p)
+        {
+            vec v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+        static void store(T *p, vec v)
+        {
+            std::memcpy(p, &v, sizeof(v));
+        }
+        static vec splat(T t)
+        {
+            return vec{} + t;
+        }
+        // The lanes in reverse order. The constant index vector lets the
+        // compiler pick the best shuffle for the instruction set.
+        template<std::size_t ...Is>
+        static vec reverse(vec v, meta::index_sequence<Is...>)
+        {
+            return __builtin_shuffle(v, mask{static_cast<std::ptrdiff_t>(lanes - 1 - Is)...});
+        }
+        static vec reverse(vec v)
+        {
+            return simd::reverse(v, meta::make_index_sequence<lanes>{});
+        }
+    };
+
+    template<typename T>
+    T const *find(T const *first, T const *last, T value)
+    {
+        using V = simd<T>;
+        auto const needle = V::splat(value);
+        // Test four vectors at a time and find the lane with scalar code
+        // once one of them matches.
+        for(; last - first >= 4 * V::lanes; first += 4 * V::lanes)
+        {
+            auto const m =
+                (V::load(first) == needle) | (V::load(first + V::lanes) == needle) |
+                (V::load(first + 2 * V::lanes) == needle) |
+                (V::load(first + 3 * V::lanes) == needle);
+            if(RANGES_SIMD_ANY(m))
+                break;
+        }
+        for(; first != last; ++first)
+            if(*first == value)
+                break;
+        return first;
+    }
+
+    template<typename T>
+    std::ptrdiff_t count(T const *first, T const *last, T value)
+    {
+        using V = simd<T>;
+        auto const needle = V::splat(value);
+        std::ptrdiff_t n = 0;
+        while(last - first >= V::lanes)
+        {
+            // A matching lane compares as -1. Flush the per-lane counts
+            // before they can overflow a signed byte.
+            decltype(needle == needle) acc = {};
+            for(int k = 0; k < 127 && last - first >= V::lanes; ++k, first += V::lanes)
+                acc += V::load(first) == needle;
+            for(std::ptrdiff_t i = 0; i < V::lanes; ++i)
+                n -= acc[i];
+        }
+        for(; first != last; ++first)
+            n += *first == value;
+        return n;
+    }
+
+    // The first element of [first1, last1) that differs from the one at the
+    // same offset from first2.
+    template<typename T>
+    T const *mismatch(T const *first1, T const *last1, T const *first2)
+    {
+        using V = simd<T>;
+        for(; last1 - first1 >= V::lanes; first1 += V::lanes, first2 += V::lanes)
+            if(RANGES_SIMD_ANY(V::load(first1) != V::load(first2)))
+                break;
+        for(; first1 != last1; ++first1, ++first2)
+            if(!(*first1 == *first2))
+                break;
+        return first1;
+    }
+
+    // The first smallest element: reduce to the minimum, then find it.
+    template<typename T>
+    T const *min_element(T const *first, T const *last)
+    {
+        using V = simd<T>;
+        if(first == last)
+            return last;
+        auto p = first;
+        T m = *p;
+        if(last - p >= V::lanes)
+        {
+            auto lo = V::load(p);
+            for(p += V::lanes; last - p >= V::lanes; p += V::lanes)
+            {
+                auto const v = V::load(p);
+                lo = v < lo ? v : lo;
+            }
+            for(std::ptrdiff_t i = 0; i < V::lanes; ++i)
+                m = lo[i] < m ? lo[i] : m;
+        }
+        for(; p != last; ++p)
+            m = *p < m ? *p : m;
+        return RANGES_SIMD_NS::find(first, last, m);
+    }
+
+    // The first largest element.
+    template<typename T>
+    T const *max_element(T const *first, T const *last)
+    {
+        using V = simd<T>;
+        if(first == last)
+            return last;
+        auto p = first;
+        T m = *p;
+        if(last - p >= V::lanes)
+        {
+            auto hi = V::load(p);
+            for(p += V::lanes; last - p >= V::lanes; p += V::lanes)
+            {
+                auto const v = V::load(p);
+                hi = hi < v ? v : hi;
+            }
+            for(std::ptrdiff_t i = 0; i < V::lanes; ++i)
+                m = m < hi[i] ? hi[i] : m;
+        }
+        for(; p != last; ++p)
+            m = m < *p ? *p : m;
+        return RANGES_SIMD_NS::find(first, last, m);
+    }
+
+    // The first byte that is in the set. Each byte is classified with three
+    // table lookups by byte shuffle: for its low nibble, the high nibbles
+    // 0-7 and 8-15 that are in the set with it, and the bit for its high
+    // nibble.
+    inline unsigned char const *find_byte_of(unsigned char const *first,
+        unsigned char const *last, byte_set const &set)
+    {
+        using V = simd<unsigned char>;
+        V::vec lo{}, hi{}, bit{};
+        for(std::ptrdiff_t i = 0; i < V::lanes; ++i)
+        {
+            unsigned const n = static_cast<unsigned>(i % 16);
+            unsigned a = 0, b = 0;
+            for(unsigned h = 0; h < 8; ++h)
+            {
+                a |= static_cast<unsigned>(set.contains(static_cast<unsigned char>(h * 16 + n))) << h;
+                b |= static_cast<unsigned>(set.contains(static_cast<unsigned char>((h + 8) * 16 + n))) << h;
+            }
+            lo[i] = static_cast<unsigned char>(a);
+            hi[i] = static_cast<unsigned char>(b);
+            bit[i] = static_cast<unsigned char>(1u << (n % 8));
+        }
+        // Keeping the top bit of a byte in its index to lo zeroes the
+        // lookup for the high nibbles 8-15, and flipping it for hi zeroes
+        // the lookup for 0-7.
+        auto const low = V::splat(0x8f), top = V::splat(0x80), nibble = V::splat(0x0f);
+        for(; last - first >= V::lanes; first += V::lanes)
+        {
+            auto const v = V::load(first);
+            auto const row = (V::vec) RANGES_SIMD_SHUFFLE_BYTES(lo, v & low) |
+                (V::vec) RANGES_SIMD_SHUFFLE_BYTES(hi, (v ^ top) & low);
+            auto const m = row & (V::vec) RANGES_SIMD_SHUFFLE_BYTES(bit, (v >> 4) & nibble);
+            if(RANGES_SIMD_ANY(m))
+                break;
+        }
+        for(; first != last; ++first)
+            if(set.contains(*first))
+                break;
+        return first;
+    }
+
+    // Replaces the matches a vector at a time, and writes back only the
+    // vectors that have one.
+    template<typename T>
+    void replace(T *first, T *last, T old_value, T new_value)
+    {
+        using V = simd<T>;
+        auto const from = V::splat(old_value), to = V::splat(new_value);
+        for(; last - first >= V::lanes; first += V::lanes)
+        {
+            auto const v = V::load(first);
+            auto const m = v == from;
+            if(RANGES_SIMD_ANY(m))
+                V::store(first, m ? to : v);
+        }
+        for(; first != last; ++first)
+            if(*first == old_value)
+                *first = new_value;
+    }
+
+    // As replace, with the mask built lane by lane. The fixed-length loop is
+    // vectorized when pred is simple enough to inline.
+    template<typename T, typename C>
+    void replace_if(T *first, T *last, C &pred, T new_value)
+    {
+        using V = simd<T>;
+        using M = typename std::remove_reference<decltype(typename V::mask{}[0])>::type;
+        auto const to = V::splat(new_value);
+        for(; last - first >= V::lanes; first += V::lanes)
+        {
+            M lanes[V::lanes];
+            for(std::ptrdiff_t i = 0; i < V::lanes; ++i)
+                lanes[i] = invoke(pred, first[i]) ? -1 : 0;
+            typename V::mask m;
+            std::memcpy(&m, lanes, sizeof(m));
+            if(RANGES_SIMD_ANY(m))
+                V::store(first, m ? to : V::load(first));
+        }
+        for(; first != last; ++first)
+            if(invoke(pred, *first))
+                *first = new_value;
+    }
+
+    // Evaluates pred a vector's worth of elements at a time, as replace_if
+    // does. Blocks with no match are skipped and blocks that all match are
+    // copied whole; the rest are copied element by element. The output
+    // either overlaps no input or starts at or before first.
+    template<typename T, typename U, typename C>
+    U *copy_if(T *first, T *last, U *out, C &pred)
+    {
+        using V = simd<U>;
+        using M = typename std::remove_reference<decltype(typename V::mask{}[0])>::type;
+        for(; last - first >= V::lanes; first += V::lanes)
+        {
+            M lanes[V::lanes];
+            std::ptrdiff_t n = 0;
+            for(std::ptrdiff_t i = 0; i < V::lanes; ++i)
+            {
+                lanes[i] = invoke(pred, first[i]) ? -1 : 0;
+                n -= lanes[i];
+            }
+            if(n == V::lanes)
+            {
+                V::store(out, V::load(first));
+                out += V::lanes;
+            }
+            else if(n != 0)
+                for(std::ptrdiff_t i = 0; i < V::lanes; ++i)
+                    if(lanes[i])
+                        *out++ = first[i];
+        }
+        for(; first != last; ++first)
+            if(invoke(pred, *first))
+                *out++ = *first;
+        return out;
+    }
+
+    // Swaps vectors from the two ends, reversing each in registers, then the
+    // middle element by element.
+    template<typename T>
+    void reverse(T *first, T *last)
+    {
+        using V = simd<T>;
+        while(last - first >= 2 * V::lanes)
+        {
+            last -= V::lanes;
+            auto const a = V::load(first), b = V::load(last);
+            V::store(first, V::reverse(b));
+            V::store(last, V::reverse(a));
+            first += V::lanes;
+        }
+        for(; last - first > 1; ++first)
+        {
+            T const t = *first;
+            *first = *--last;
+            *last = t;
+        }
+    }
+
+    template<typename T>
+    void swap_ranges(T *first1, T *last1, T *first2)
+    {
+        using V = simd<T>;
+        for(; last1 - first1 >= V::lanes; first1 += V::lanes, first2 += V::lanes)
+        {
+            auto const a = V::load(first1), b = V::load(first2);
+            V::store(first1, b);
+            V::store(first2, a);
+        }
+        for(; first1 != last1; ++first1, ++first2)
+        {
+            T const t = *first1;
+            *first1 = *first2;
+            *first2 = t;
+        }
+    }
+
+    // The transform kernels work in blocks of a fixed number of elements,
+    // which the compiler vectorizes when fun is simple enough to inline. The
+    // output either is the first input or overlaps no input.
+    template<typename T, typename U>
+    constexpr std::ptrdiff_t transform_block()
+    {
+        return 2 * RANGES_SIMD_BYTES / (sizeof(T) < sizeof(U) ? sizeof(T) : sizeof(U));
+    }
+
+    template<typename T, typename F>
+    void transform_in_place(T *first, T *last, F &fun)
+    {
+        constexpr std::ptrdiff_t n = RANGES_SIMD_NS::transform_block<T, T>();
+        for(; last - first >= n; first += n)
+            for(std::ptrdiff_t i = 0; i < n; ++i)
+                first[i] = invoke(fun, first[i]);
+        for(; first != last; ++first)
+            *first = invoke(fun, *first);
+    }
+
+    template<typename T, typename U, typename F>
+    void transform(T *__restrict first, T *last, U *__restrict out, F &fun)
+    {
+        constexpr std::ptrdiff_t n =
+            RANGES_SIMD_NS::transform_block<meta::_t<std::remove_const<T>>, U>();
+        for(; last - first >= n; first += n, out += n)
+            for(std::ptrdiff_t i = 0; i < n; ++i)
+                out[i] = invoke(fun, first[i]);
+        for(; first != last; ++first, ++out)
+            *out = invoke(fun, *first);
+    }
+
+    template<typename T0, typename T1, typename F>
+    void transform2_in_place(T0 *first0, T0 *last0, T1 *__restrict first1, F &fun)
+    {
+        constexpr std::ptrdiff_t n = RANGES_SIMD_NS::transform_block<T0, T0>();
+        for(; last0 - first0 >= n; first0 += n, first1 += n)
+            for(std::ptrdiff_t i = 0; i < n; ++i)
+                first0[i] = invoke(fun, first0[i], first1[i]);
+        for(; first0 != last0; ++first0, ++first1)
+            *first0 = invoke(fun, *first0, *first1);
+    }
+
+    template<typename T0, typename T1, typename U, typename F>
+    void transform2(T0 *__restrict first0, T0 *last0, T1 *__restrict first1,
+        U *__restrict out, F &fun)
+    {
+        constexpr std::ptrdiff_t n =
+            RANGES_SIMD_NS::transform_block<meta::_t<std::remove_const<T0>>, U>();
+        for(; last0 - first0 >= n; first0 += n, first1 += n, out += n)
+            for(std::ptrdiff_t i = 0; i < n; ++i)
+                out[i] = invoke(fun, first0[i], first1[i]);
+        for(; first0 != last0; ++first0, ++first1, ++out)
+            *out = invoke(fun, *first0, *first1);
+    }
+}
@@ -14,8 +14,11 @@
 #ifndef RANGES_V3_GETLINES_HPP
 #define RANGES_V3_GETLINES_HPP
 
+#include <algorithm>
+#include <cstddef>
 #include <string>
 #include <istream>
+#include <vector>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/view_facade.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -90,6 +93,148 @@ namespace ranges
         };
 
         RANGES_INLINE_VARIABLE(getlines_fn, getlines)
+
+        /// The lines of a seekable stream, last line first. The stream is read
+        /// backward in blocks, so reading the last few lines costs in
+        /// proportion to their length rather than to the size of the stream.
+        /// As with `getlines`, a delimiter at the very end of the stream does
+        /// not start an empty last line. If a read fails, the range ends
+        /// without yielding the partial line and leaves `failbit` set on the
+        /// stream.
+        struct getlines_reverse_range
+          : view_facade<getlines_reverse_range, unknown>
+        {
+        private:
+            friend range_access;
+            std::istream *sin_;
+            std::string str_;
+            // The unread text just before the current line, which starts at
+            // offset pos_ in the stream.
+            std::string buf_;
+            std::streamoff pos_;
+            std::size_t block_;
+            char delim_;
+            // Whether the line at the start of the stream has been read, and
+            // whether it has been passed.
+            bool first_line_;
+            bool done_;
+            struct cursor
+            {
+            private:
+                getlines_reverse_range *rng_;
+            public:
+                cursor() = default;
+                explicit cursor(getlines_reverse_range &rng)
+                  : rng_(&rng)
+                {}
+                void next()
+                {
+                    rng_->next();
+                }
+                std::string &read() const noexcept
+                {
+                    return rng_->str_;
+                }
+                bool equal(default_sentinel) const
+                {
+                    return rng_->done_;
+                }
+                std::string && move() const noexcept
+                {
+                    return detail::move(rng_->str_);
+                }
+            };
+            // Reads the block of the stream before pos_ into buf_.
+            bool read_block()
+            {
+                auto const n = std::min<std::streamoff>(pos_,
+                    static_cast<std::streamoff>(block_));
+                pos_ -= n;
+                buf_.assign(static_cast<std::size_t>(n), '\0');
+                if(!sin_->seekg(pos_) || !sin_->read(&buf_[0], n))
+                {
+                    sin_->setstate(std::ios_base::failbit);
+                    done_ = true;
+                    return false;
+                }
+                return true;
+            }
+            void next()
+            {
+                if(first_line_)
+                {
+                    done_ = true;
+                    return;
+                }
+                // The blocks after buf_ that hold the rest of the line, last
+                // first. They are joined once the line's start is found, so
+                // long lines cost time linear in their length.
+                std::vector<std::string> tail;
+                auto i = buf_.rfind(delim_);
+                while(i == std::string::npos && pos_ != 0)
+                {
+                    tail.push_back(std::move(buf_));
+                    if(!this->read_block())
+                        return;
+                    i = buf_.rfind(delim_);
+                }
+                if(i == std::string::npos)
+                {
+                    str_.swap(buf_);
+                    buf_.clear();
+                    first_line_ = true;
+                }
+                else
+                {
+                    str_.assign(buf_, i + 1, std::string::npos);
+                    buf_.resize(i);
+                }
+                for(auto it = tail.rbegin(); it != tail.rend(); ++it)
+                    str_ += *it;
+            }
+            cursor begin_cursor()
+            {
+                return cursor{*this};
+            }
+        public:
+            getlines_reverse_range() = default;
+            getlines_reverse_range(std::istream &sin, char delim = '\n',
+                std::size_t block = 1u << 16)
+              : sin_(&sin), str_{}, buf_{}, pos_(0), block_(block), delim_(delim)
+              , first_line_(false), done_(false)
+            {
+                RANGES_EXPECT(0 < block_);
+                pos_ = sin_->seekg(0, std::ios_base::end) ? std::streamoff(sin_->tellg()) : 0;
+                if(pos_ <= 0)
+                {
+                    done_ = true;
+                    return;
+                }
+                if(!this->read_block())
+                    return;
+                if(buf_.back() == delim_)
+                    buf_.pop_back();
+                this->next(); // prime the pump
+            }
+            std::string & cached() noexcept
+            {
+                return str_;
+            }
+        };
+
+        struct getlines_reverse_fn
+        {
+            getlines_reverse_range operator()(std::istream & sin, char delim = '\n',
+                std::size_t block = 1u << 16) const
+            {
+                return getlines_reverse_range{sin, delim, block};
+            }
+        };
+
+        /// `getlines_reverse(sin)` yields the lines of the seekable stream
+        /// `sin`, last line first.
+        /// \sa `getlines_reverse_range`
+        RANGES_INLINE_VARIABLE(getlines_reverse_fn, getlines_reverse)
         /// @}
     }
 }
@@ -0,0 +1,381 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_HASH_HPP
+#define RANGES_V3_HASH_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/data.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/concepts.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/tuple_algorithm.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // The byte hash is in the style of wyhash: 64x64->128-bit multiplies
+            // folded back to 64 bits, over 48-byte blocks in three independent
+            // lanes. Hash values depend on the byte order of the target and are
+            // not stable across library versions.
+            constexpr std::uint64_t hash_secret[4] = {
+                0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+                0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+
+        #ifdef __SIZEOF_INT128__
+            __extension__ typedef unsigned __int128 hash_uint128;
+
+            inline void hash_mum(std::uint64_t &a, std::uint64_t &b)
+            {
+                hash_uint128 r = a;
+                r *= b;
+                a = static_cast<std::uint64_t>(r);
+                b = static_cast<std::uint64_t>(r >> 64);
+            }
+        #else
+            inline void hash_mum(std::uint64_t &a, std::uint64_t &b)
+            {
+                std::uint64_t const ha = a >> 32, hb = b >> 32;
+                std::uint64_t const la = a & 0xffffffffu, lb = b & 0xffffffffu;
+                std::uint64_t const rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+                std::uint64_t const t = rl + (rm0 << 32);
+                std::uint64_t lo = t + (rm1 << 32);
+                std::uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + (t < rl) + (lo < t);
+                a = lo;
+                b = hi;
+            }
+        #endif
+
+            inline std::uint64_t hash_mix(std::uint64_t a, std::uint64_t b)
+            {
+                detail::hash_mum(a, b);
+                return a ^ b;
+            }
+
+            inline std::uint64_t hash_read8(unsigned char const *p)
+            {
+                std::uint64_t v;
+                std::memcpy(&v, p, 8);
+                return v;
+            }
+
+            inline std::uint64_t hash_read4(unsigned char const *p)
+            {
+                std::uint32_t v;
+                std::memcpy(&v, p, 4);
+                return v;
+            }
+
+            inline std::uint64_t hash_read3(unsigned char const *p, std::size_t n)
+            {
+                return (std::uint64_t(p[0]) << 16) | (std::uint64_t(p[n >> 1]) << 8) | p[n - 1];
+            }
+
+            inline std::uint64_t hash_seed(std::uint64_t seed)
+            {
+                return seed ^ detail::hash_mix(seed ^ hash_secret[0], hash_secret[1]);
+            }
+
+            // Reduces a block of 48 bytes into the three lanes.
+            inline void hash_block(unsigned char const *p, std::uint64_t &seed,
+                std::uint64_t &see1, std::uint64_t &see2)
+            {
+                seed = detail::hash_mix(hash_read8(p) ^ hash_secret[1], hash_read8(p + 8) ^ seed);
+                see1 = detail::hash_mix(hash_read8(p + 16) ^ hash_secret[2], hash_read8(p + 24) ^ see1);
+                see2 = detail::hash_mix(hash_read8(p + 32) ^ hash_secret[3], hash_read8(p + 40) ^ see2);
+            }
+
+            // Hashes the last i bytes at p, where 0 < i <= 48 and the 16 bytes
+            // before p are readable if i < 16 and the input was longer than 16.
+            inline std::uint64_t hash_tail(unsigned char const *p, std::size_t i,
+                std::uint64_t len, std::uint64_t seed)
+            {
+                std::uint64_t a, b;
+                if(len <= 16)
+                {
+                    if(len >= 4)
+                    {
+                        std::size_t const k = (i >> 3) << 2;
+                        a = (hash_read4(p) << 32) | hash_read4(p + k);
+                        b = (hash_read4(p + i - 4) << 32) | hash_read4(p + i - 4 - k);
+                    }
+                    else if(len > 0)
+                    {
+                        a = hash_read3(p, i);
+                        b = 0;
+                    }
+                    else
+                        a = b = 0;
+                }
+                else
+                {
+                    for(; i > 16; i -= 16, p += 16)
+                        seed = detail::hash_mix(hash_read8(p) ^ hash_secret[1],
+                            hash_read8(p + 8) ^ seed);
+                    a = hash_read8(p + i - 16);
+                    b = hash_read8(p + i - 8);
+                }
+                a ^= hash_secret[1];
+                b ^= seed;
+                detail::hash_mum(a, b);
+                return detail::hash_mix(a ^ hash_secret[0] ^ len, b ^ hash_secret[1]);
+            }
+
+            inline std::uint64_t hash_bytes(void const *data, std::size_t len,
+                std::uint64_t seed = 0)
+            {
+                auto p = static_cast<unsigned char const *>(data);
+                seed = detail::hash_seed(seed);
+                std::size_t i = len;
+                if(i > 48)
+                {
+                    std::uint64_t see1 = seed, see2 = seed;
+                    do
+                    {
+                        detail::hash_block(p, seed, see1, see2);
+                        p += 48;
+                        i -= 48;
+                    } while(i > 48);
+                    seed ^= see1 ^ see2;
+                }
+                return detail::hash_tail(p, i, len, seed);
+            }
+
+            template<typename T>
+            using ByteHashable = meta::or_<
+                meta::and_<std::is_integral<T>, meta::not_<std::is_same<T, bool>>>,
+                std::is_enum<T>,
+                std::is_pointer<T>>;
+        }
+        /// \endcond
+
+        /// \addtogroup group-core
+        /// @{
+
+        /// Incrementally hashes a sequence of bytes. Feeding the same bytes in
+        /// any number of pieces gives the same result as hashing them in one
+        /// piece; `combine` feeds the eight bytes of an already computed hash.
+        struct hash_combiner
+        {
+        private:
+            // 16 bytes of history for the overlapping tail read, then up to
+            // 96 pending bytes.
+            unsigned char buf_[16 + 96];
+            std::size_t pending_ = 0;
+            std::uint64_t len_ = 0;
+            std::uint64_t seed_, see1_, see2_;
+            bool bulk_ = false;
+
+            void drain()
+            {
+                while(pending_ > 48)
+                {
+                    detail::hash_block(buf_ + 16, seed_, see1_, see2_);
+                    bulk_ = true;
+                    // The last 16 bytes of the block become the history.
+                    std::memmove(buf_, buf_ + 48, pending_ - 32);
+                    pending_ -= 48;
+                }
+            }
+        public:
+            explicit hash_combiner(std::uint64_t seed = 0)
+              : seed_(detail::hash_seed(seed)), see1_(seed_), see2_(seed_)
+            {}
+            void update(void const *data, std::size_t n)
+            {
+                auto p = static_cast<unsigned char const *>(data);
+                len_ += n;
+                while(n != 0)
+                {
+                    std::size_t const k = n < 96 - pending_ ? n : 96 - pending_;
+                    std::memcpy(buf_ + 16 + pending_, p, k);
+                    pending_ += k;
+                    p += k;
+                    n -= k;
+                    drain();
+                }
+            }
+            void combine(std::uint64_t h)
+            {
+                update(&h, sizeof(h));
+            }
+            std::uint64_t result() const
+            {
+                std::uint64_t seed = seed_;
+                if(bulk_)
+                    seed ^= see1_ ^ see2_;
+                return detail::hash_tail(buf_ + 16, pending_, len_, seed);
+            }
+        };
+
+        namespace concepts
+        {
+            struct Hasher
+            {
+                template<typename H, typename T>
+                auto requires_(H &&h, T &&t) -> decltype(
+                    concepts::valid_expr(
+                        concepts::convertible_to<std::uint64_t>(
+                            invoke(static_cast<H &&>(h), static_cast<T &&>(t)))
+                    ));
+            };
+        }
+
+        template<typename H, typename T>
+        using Hasher = concepts::models<concepts::Hasher, H, T>;
+
+        struct hasher;
+
+        struct hash_range_fn
+        {
+        private:
+            template<typename Rng, typename H>
+            using Bytes_ = meta::strict_and<
+                std::is_same<H, hasher>,
+                ContiguousRange<Rng>,
+                SizedRange<Rng>,
+                detail::ByteHashable<range_value_t<Rng>>>;
+
+            template<typename Rng, typename H,
+                CONCEPT_REQUIRES_(Bytes_<Rng, H>())>
+            static std::uint64_t impl(Rng &rng, H &, detail::priority_tag<2>)
+            {
+                return detail::hash_bytes(ranges::data(rng),
+                    static_cast<std::size_t>(ranges::size(rng)) * sizeof(range_value_t<Rng>));
+            }
+            template<typename Rng, typename H, typename V = range_value_t<Rng>,
+                CONCEPT_REQUIRES_(std::is_same<H, hasher>() && detail::ByteHashable<V>())>
+            static std::uint64_t impl(Rng &rng, H &, detail::priority_tag<1>)
+            {
+                hash_combiner h;
+                for(auto it = ranges::begin(rng), e = ranges::end(rng); it != e; ++it)
+                {
+                    V const v = *it;
+                    h.update(&v, sizeof(V));
+                }
+                return h.result();
+            }
+            template<typename Rng, typename H>
+            static std::uint64_t impl(Rng &rng, H &hash, detail::priority_tag<0>)
+            {
+                hash_combiner h;
+                for(auto it = ranges::begin(rng), e = ranges::end(rng); it != e; ++it)
+                    h.combine(static_cast<std::uint64_t>(invoke(hash, *it)));
+                return h.result();
+            }
+        public:
+            /// Hashes the elements of `rng` with `hash` and combines the results
+            /// in order. With the default hasher, ranges of integers, enums and
+            /// pointers are hashed as the bytes of their elements, in bulk when
+            /// `rng` is contiguous; equal sequences hash equal regardless of the
+            /// type of range that holds them.
+            template<typename Rng, typename H = hasher,
+                CONCEPT_REQUIRES_(InputRange<Rng>() &&
+                    Hasher<H &, range_reference_t<Rng>>())>
+            std::uint64_t operator()(Rng &&rng, H hash = H{}) const
+            {
+                static_assert(!is_infinite<Rng>::value,
+                    "Attempt to hash an infinite range.");
+                return hash_range_fn::impl(rng, hash, detail::priority_tag<2>{});
+            }
+        };
+
+        /// \sa `hash_range_fn`
+        RANGES_INLINE_VARIABLE(hash_range_fn, hash_range)
+
+        /// A hash function object with better mixing than `std::hash`. Integers,
+        /// enums and pointers are hashed by their bytes; floating-point values
+        /// so that `0.0` and `-0.0` collide; ranges with `hash_range`; pairs and
+        /// tuples by combining the hashes of their elements; anything else by
+        /// mixing the result of `std::hash`.
+        struct hasher
+        {
+        private:
+            struct element_fn
+            {
+                hash_combiner &h;
+                template<typename T>
+                void operator()(T const &t) const
+                {
+                    h.combine(hasher{}(t));
+                }
+            };
+
+            template<typename T, CONCEPT_REQUIRES_(detail::ByteHashable<T>())>
+            static std::uint64_t impl(T const &t, detail::priority_tag<4>)
+            {
+                return detail::hash_bytes(&t, sizeof(T));
+            }
+            template<typename T,
+                CONCEPT_REQUIRES_(std::is_same<T, float>() || std::is_same<T, double>())>
+            static std::uint64_t impl(T t, detail::priority_tag<4>)
+            {
+                if(t == T(0))
+                    t = T(0);
+                return detail::hash_bytes(&t, sizeof(T));
+            }
+            template<typename Rng, CONCEPT_REQUIRES_(InputRange<Rng const>())>
+            static std::uint64_t impl(Rng const &rng, detail::priority_tag<3>)
+            {
+                return hash_range(rng);
+            }
+            template<typename F, typename S>
+            static std::uint64_t impl(std::pair<F, S> const &p, detail::priority_tag<2>)
+            {
+                hash_combiner h;
+                h.combine(hasher{}(p.first));
+                h.combine(hasher{}(p.second));
+                return h.result();
+            }
+            template<typename... Ts>
+            static std::uint64_t impl(std::tuple<Ts...> const &t, detail::priority_tag<2>)
+            {
+                hash_combiner h;
+                tuple_for_each(t, element_fn{h});
+                return h.result();
+            }
+            template<typename T,
+                typename = decltype(std::hash<T>{}(std::declval<T const &>()))>
+            static std::uint64_t impl(T const &t, detail::priority_tag<0>)
+            {
+                std::uint64_t const v = std::hash<T>{}(t);
+                return detail::hash_mix(v ^ detail::hash_secret[0], detail::hash_secret[1]);
+            }
+        public:
+            template<typename T>
+            auto operator()(T const &t) const ->
+                decltype(hasher::impl(t, detail::priority_tag<4>{}))
+            {
+                return hasher::impl(t, detail::priority_tag<4>{});
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
@@ -0,0 +1,357 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_INCREMENTAL_HPP
+#define RANGES_V3_INCREMENTAL_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-core
+        /// @{
+
+        /// Stages of an `incremental` pipeline. A stage is a description from
+        /// which the pipeline builds, for its input type `T`, a stateful
+        /// `S::state<T>`. The state is constructed from the stage, names its
+        /// output type as `output_t`, and is called once per input element, in
+        /// order, as `state(x, sink)`; it may call `sink` any number of times to
+        /// pass elements on to the next stage.
+        namespace stage
+        {
+            template<typename Pred>
+            struct filter_stage
+            {
+                Pred pred_;
+
+                template<typename T>
+                struct state
+                {
+                    using output_t = T;
+                    semiregular_t<Pred> pred_;
+
+                    explicit state(filter_stage const &s)
+                      : pred_(s.pred_)
+                    {}
+                    template<typename Sink>
+                    void operator()(T const &t, Sink &sink)
+                    {
+                        if(invoke(pred_, t))
+                            sink(t);
+                    }
+                };
+            };
+
+            template<typename Fun>
+            struct transform_stage
+            {
+                Fun fun_;
+
+                template<typename T>
+                struct state
+                {
+                    using output_t = detail::decay_t<result_of_t<Fun &(T const &)>>;
+                    semiregular_t<Fun> fun_;
+
+                    explicit state(transform_stage const &s)
+                      : fun_(s.fun_)
+                    {}
+                    template<typename Sink>
+                    void operator()(T const &t, Sink &sink)
+                    {
+                        sink(invoke(fun_, t));
+                    }
+                };
+            };
+
+            template<typename Fun>
+            struct partial_sum_stage
+            {
+                Fun fun_;
+
+                // The running total carries over from one refresh to the next.
+                template<typename T>
+                struct state
+                {
+                    using output_t = T;
+                    semiregular_t<Fun> fun_;
+                    optional<T> sum_;
+
+                    explicit state(partial_sum_stage const &s)
+                      : fun_(s.fun_), sum_()
+                    {}
+                    template<typename Sink>
+                    void operator()(T const &t, Sink &sink)
+                    {
+                        if(sum_)
+                            sum_ = static_cast<T>(invoke(fun_, *sum_, t));
+                        else
+                            sum_ = t;
+                        sink(*sum_);
+                    }
+                };
+            };
+
+            template<typename Rel, typename Acc, typename Fold>
+            struct group_by_stage
+            {
+                Rel rel_;
+                Acc init_;
+                Fold fold_;
+
+                // The open group, and its aggregate so far, carry over from one
+                // refresh to the next. A group's aggregate is passed on when an
+                // element arrives that does not belong to it.
+                template<typename T>
+                struct state
+                {
+                    using output_t = Acc;
+                    semiregular_t<Rel> rel_;
+                    Acc init_;
+                    semiregular_t<Fold> fold_;
+                    optional<T> first_;
+                    Acc acc_;
+
+                    explicit state(group_by_stage const &s)
+                      : rel_(s.rel_), init_(s.init_), fold_(s.fold_), first_(), acc_(s.init_)
+                    {}
+                    template<typename Sink>
+                    void operator()(T const &t, Sink &sink)
+                    {
+                        if(first_ && invoke(rel_, *first_, t))
+                        {
+                            acc_ = invoke(fold_, std::move(acc_), t);
+                            return;
+                        }
+                        if(first_)
+                            sink(acc_);
+                        first_ = t;
+                        acc_ = invoke(fold_, init_, t);
+                    }
+                };
+            };
+
+            struct filter_fn
+            {
+                template<typename Pred>
+                filter_stage<Pred> operator()(Pred pred) const
+                {
+                    return {std::move(pred)};
+                }
+            };
+
+            struct transform_fn
+            {
+                template<typename Fun>
+                transform_stage<Fun> operator()(Fun fun) const
+                {
+                    return {std::move(fun)};
+                }
+            };
+
+            struct partial_sum_fn
+            {
+                template<typename Fun = plus>
+                partial_sum_stage<Fun> operator()(Fun fun = Fun{}) const
+                {
+                    return {std::move(fun)};
+                }
+            };
+
+            struct group_by_fn
+            {
+                template<typename Rel, typename Acc, typename Fold>
+                group_by_stage<Rel, Acc, Fold> operator()(Rel rel, Acc init, Fold fold) const
+                {
+                    return {std::move(rel), std::move(init), std::move(fold)};
+                }
+            };
+
+            /// Passes on the elements that satisfy a predicate.
+            /// \sa `filter_fn`
+            RANGES_INLINE_VARIABLE(filter_fn, filter)
+
+            /// Passes on the result of a function applied to each element.
+            /// \sa `transform_fn`
+            RANGES_INLINE_VARIABLE(transform_fn, transform)
+
+            /// Passes on the running total of the elements.
+            /// \sa `partial_sum_fn`
+            RANGES_INLINE_VARIABLE(partial_sum_fn, partial_sum)
+
+            /// `group_by(rel, init, fold)` passes on one aggregate per group of
+            /// consecutive elements `x` for which `rel(first, x)` holds, where
+            /// `first` is the first element of the group. The aggregate starts
+            /// from `init` and is updated with `fold(acc, x)`. The last group is
+            /// still open, so its aggregate has not been passed on yet.
+            /// \sa `group_by_fn`
+            RANGES_INLINE_VARIABLE(group_by_fn, group_by)
+        }
+
+        /// \cond
+        namespace detail
+        {
+            template<typename T, typename...Stages>
+            struct incremental_chain;
+
+            template<typename T>
+            struct incremental_chain<T>
+            {
+                using value_type = T;
+                std::vector<T> out_;
+
+                incremental_chain() = default;
+                void operator()(T const &t)
+                {
+                    out_.push_back(t);
+                }
+                std::vector<T> &output()
+                {
+                    return out_;
+                }
+                std::vector<T> const &output() const
+                {
+                    return out_;
+                }
+            };
+
+            template<typename T, typename Stage, typename...Rest>
+            struct incremental_chain<T, Stage, Rest...>
+            {
+                using state_t = typename Stage::template state<T>;
+                using next_t = incremental_chain<typename state_t::output_t, Rest...>;
+                using value_type = typename next_t::value_type;
+                state_t state_;
+                next_t next_;
+
+                incremental_chain(Stage const &stage, Rest const &...rest)
+                  : state_(stage), next_(rest...)
+                {}
+                void operator()(T const &t)
+                {
+                    state_(t, next_);
+                }
+                std::vector<value_type> &output()
+                {
+                    return next_.output();
+                }
+                std::vector<value_type> const &output() const
+                {
+                    return next_.output();
+                }
+            };
+        }
+        /// \endcond
+
+        /// The materialized output of a pipeline of stages over an append-only
+        /// source. `refresh()` feeds only the source elements appended since the
+        /// last refresh through the stages, whose state (running totals, open
+        /// groups) persists in between, and appends to the output. The cost of a
+        /// refresh is proportional to the number of new elements.
+        template<typename Rng, typename...Stages>
+        struct incremental_pipeline
+        {
+        private:
+            using chain_t = detail::incremental_chain<range_value_t<Rng>, Stages...>;
+            Rng *src_;
+            range_size_t<Rng> consumed_;
+            chain_t initial_;
+            chain_t chain_;
+        public:
+            using value_type = typename chain_t::value_type;
+
+            incremental_pipeline(Rng &src, Stages const &...stages)
+              : src_(&src), consumed_(0), initial_(stages...), chain_(initial_)
+            {
+                refresh();
+            }
+            /// Processes the elements appended to the source since the last
+            /// refresh, and returns the number of elements appended to the output.
+            /// The source must not have shrunk.
+            std::size_t refresh()
+            {
+                auto const n = ranges::size(*src_);
+                RANGES_EXPECT(consumed_ <= n);
+                auto const before = chain_.output().size();
+                auto it = ranges::begin(*src_) +
+                    static_cast<range_difference_t<Rng>>(consumed_);
+                for(; consumed_ != n; ++consumed_, ++it)
+                    chain_(*it);
+                return chain_.output().size() - before;
+            }
+            /// Discards the output and all stage state, and reprocesses the whole
+            /// source. For use when the source was modified other than by
+            /// appending.
+            void rebuild()
+            {
+                chain_ = initial_;
+                consumed_ = 0;
+                refresh();
+            }
+            /// The number of source elements processed so far.
+            range_size_t<Rng> consumed() const
+            {
+                return consumed_;
+            }
+            std::vector<value_type> const &output() const
+            {
+                return chain_.output();
+            }
+            typename std::vector<value_type>::const_iterator begin() const
+            {
+                return chain_.output().begin();
+            }
+            typename std::vector<value_type>::const_iterator end() const
+            {
+                return chain_.output().end();
+            }
+            std::size_t size() const
+            {
+                return chain_.output().size();
+            }
+        };
+
+        struct incremental_fn
+        {
+            template<typename Rng, typename...Stages,
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>() && SizedRange<Rng>())>
+            incremental_pipeline<Rng, Stages...> operator()(Rng &src, Stages...stages) const
+            {
+                return {src, stages...};
+            }
+        };
+
+        /// `incremental(src, stage...)` processes the random-access, sized,
+        /// append-only range `src` through the given stages.
+        /// \sa `incremental_pipeline`
+        /// \sa `incremental_fn`
+        RANGES_INLINE_VARIABLE(incremental_fn, incremental)
+        /// @}
+    }
+}
+
+#endif
@@ -0,0 +1,586 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_MAPPED_VECTOR_HPP
+#define RANGES_V3_MAPPED_VECTOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/distance.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#error "mapped_vector requires POSIX mmap"
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-core
+        /// @{
+
+        /// Where the elements of a named `mapped_vector` live: in a file, or
+        /// in a POSIX shared memory object such as `"/frames"`.
+        enum class mapped_kind
+        {
+            file,
+            shared_memory
+        };
+
+        /// Whether a named `mapped_vector` starts out empty, replacing any
+        /// existing storage of that name, or opens the elements another
+        /// process stored there.
+        enum class mapped_mode
+        {
+            create,
+            open
+        };
+        /// @}
+
+        /// \cond
+        namespace detail
+        {
+            // The start of every mapping. Elements follow at offset
+            // mapped_header_size.
+            struct mapped_header
+            {
+                std::uint64_t magic;
+                std::uint64_t size;
+                std::uint64_t value_size;
+            };
+
+            constexpr std::uint64_t mapped_magic = 0x52414e47454d5631; // "RANGEMV1"
+            constexpr std::size_t mapped_header_size = 64;
+
+            [[noreturn]] inline void throw_mapped_error(char const *what)
+            {
+                throw std::system_error{errno, std::system_category(), what};
+            }
+
+            // An open descriptor mapped shared, read-write, from offset 0.
+            struct mapped_region
+            {
+            private:
+                int fd_ = -1;
+                void *base_ = nullptr;
+                std::size_t bytes_ = 0;
+
+                void map(std::size_t bytes)
+                {
+                    void *const p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                        fd_, 0);
+                    if(p == MAP_FAILED)
+                        detail::throw_mapped_error("mmap");
+                    base_ = p;
+                    bytes_ = bytes;
+                }
+                void reset() noexcept
+                {
+                    if(base_)
+                        ::munmap(base_, bytes_);
+                    if(fd_ != -1)
+                        ::close(fd_);
+                    fd_ = -1, base_ = nullptr, bytes_ = 0;
+                }
+                static std::size_t page_size()
+                {
+                    static std::size_t const page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+                    return page;
+                }
+                static int open_fd(mapped_kind kind, std::string const &name, int flags)
+                {
+                    int const fd = kind == mapped_kind::file
+                        ? ::open(name.c_str(), flags | O_CLOEXEC, 0666)
+                        : ::shm_open(name.c_str(), flags, 0666);
+                    if(fd == -1)
+                        detail::throw_mapped_error(kind == mapped_kind::file ? "open" : "shm_open");
+                    return fd;
+                }
+                static int anonymous_fd()
+                {
+                #if defined(__linux__) && defined(MFD_CLOEXEC)
+                    int const fd = ::memfd_create("ranges.mapped_vector", MFD_CLOEXEC);
+                    if(fd == -1)
+                        detail::throw_mapped_error("memfd_create");
+                    return fd;
+                #else
+                    // A shared memory object that nobody else can open.
+                    static std::atomic<unsigned> counter{0};
+                    for(;;)
+                    {
+                        std::string const name = "/ranges.mapped_vector." +
+                            std::to_string(::getpid()) + "." + std::to_string(counter++);
+                        int const fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+                        if(fd != -1)
+                        {
+                            ::shm_unlink(name.c_str());
+                            return fd;
+                        }
+                        if(errno != EEXIST)
+                            detail::throw_mapped_error("shm_open");
+                    }
+                #endif
+                }
+            public:
+                mapped_region() = default;
+                // Creates storage of one page, with an empty header.
+                mapped_region(int fd, std::size_t value_size)
+                  : fd_(fd)
+                {
+                    try
+                    {
+                        if(::ftruncate(fd_, static_cast<off_t>(page_size())) == -1)
+                            detail::throw_mapped_error("ftruncate");
+                        this->map(page_size());
+                    }
+                    catch(...)
+                    {
+                        this->reset();
+                        throw;
+                    }
+                    *header() = {mapped_magic, 0, value_size};
+                }
+                explicit mapped_region(std::size_t value_size)
+                  : mapped_region(anonymous_fd(), value_size)
+                {}
+                mapped_region(mapped_kind kind, std::string const &name, mapped_mode mode,
+                    std::size_t value_size)
+                  : mapped_region()
+                {
+                    if(mode == mapped_mode::create)
+                    {
+                        *this = mapped_region(open_fd(kind, name, O_RDWR | O_CREAT | O_TRUNC),
+                            value_size);
+                        return;
+                    }
+                    fd_ = open_fd(kind, name, O_RDWR);
+                    try
+                    {
+                        struct stat st;
+                        if(::fstat(fd_, &st) == -1)
+                            detail::throw_mapped_error("fstat");
+                        auto const bytes = static_cast<std::size_t>(st.st_size);
+                        if(bytes < mapped_header_size)
+                        {
+                            errno = EINVAL;
+                            detail::throw_mapped_error("mapped_vector: no header");
+                        }
+                        this->map(bytes);
+                        auto const &h = *header();
+                        if(h.magic != mapped_magic || h.value_size != value_size ||
+                           mapped_header_size + h.size * value_size > bytes)
+                        {
+                            errno = EINVAL;
+                            detail::throw_mapped_error("mapped_vector: bad header");
+                        }
+                    }
+                    catch(...)
+                    {
+                        this->reset();
+                        throw;
+                    }
+                }
+                mapped_region(mapped_region &&that) noexcept
+                  : fd_(that.fd_), base_(that.base_), bytes_(that.bytes_)
+                {
+                    that.fd_ = -1, that.base_ = nullptr, that.bytes_ = 0;
+                }
+                mapped_region &operator=(mapped_region &&that) noexcept
+                {
+                    std::swap(fd_, that.fd_);
+                    std::swap(base_, that.base_);
+                    std::swap(bytes_, that.bytes_);
+                    return *this;
+                }
+                ~mapped_region()
+                {
+                    this->reset();
+                }
+                mapped_header *header() const noexcept
+                {
+                    return static_cast<mapped_header *>(base_);
+                }
+                unsigned char *data() const noexcept
+                {
+                    return base_ ? static_cast<unsigned char *>(base_) + mapped_header_size
+                        : nullptr;
+                }
+                std::size_t bytes() const noexcept
+                {
+                    return bytes_;
+                }
+                int fd() const noexcept
+                {
+                    return fd_;
+                }
+                // Grows the storage to at least bytes, rounded up to whole
+                // pages, and maps all of it. The mapping may move.
+                void grow(std::size_t bytes)
+                {
+                    bytes = (bytes + page_size() - 1) / page_size() * page_size();
+                    if(::ftruncate(fd_, static_cast<off_t>(bytes)) == -1)
+                        detail::throw_mapped_error("ftruncate");
+                    this->remap(bytes);
+                }
+                // Maps the first bytes of the storage, which must exist.
+                void remap(std::size_t bytes)
+                {
+                #if defined(__linux__)
+                    void *const p = ::mremap(base_, bytes_, bytes, MREMAP_MAYMOVE);
+                    if(p == MAP_FAILED)
+                        detail::throw_mapped_error("mremap");
+                    base_ = p;
+                    bytes_ = bytes;
+                #else
+                    void *const old = base_;
+                    std::size_t const old_bytes = bytes_;
+                    this->map(bytes);
+                    ::munmap(old, old_bytes);
+                #endif
+                }
+                // The size of the underlying storage, which another process
+                // may have grown.
+                std::size_t storage_bytes() const
+                {
+                    struct stat st;
+                    if(::fstat(fd_, &st) == -1)
+                        detail::throw_mapped_error("fstat");
+                    return static_cast<std::size_t>(st.st_size);
+                }
+                void sync() const
+                {
+                    if(base_ && ::msync(base_, bytes_, MS_SYNC) == -1)
+                        detail::throw_mapped_error("msync");
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-core
+        /// @{
+
+        /// A contiguous container of trivially copyable elements that live in
+        /// a shared memory mapping instead of on the heap, so that other
+        /// processes can map them without copying. It grows by enlarging the
+        /// underlying storage and remapping it, and has the usual `vector`
+        /// members, so it can be the target of `to_` and of actions:
+        /// \code
+        /// // Producer: materialize straight into a named segment.
+        /// mapped_vector<float> out{mapped_kind::shared_memory, "/frames"};
+        /// action::push_back(out, rng | view::transform(f));
+        /// // Consumer, in another process:
+        /// mapped_vector<float> in{mapped_kind::shared_memory, "/frames", mapped_mode::open};
+        /// \endcode
+        /// A default-constructed `mapped_vector`, like the one `to_` fills, is
+        /// backed by anonymous shared memory: it is shared with child
+        /// processes forked after the mapping is made, and `native_handle()`
+        /// is a descriptor that can be passed to other processes.
+        ///
+        /// The element count is stored in the mapping with the elements. A
+        /// process that opened existing storage sees elements appended by
+        /// another process after a call to `refresh()`; the processes must
+        /// order those accesses themselves. Copies are not supported, and
+        /// destroying a `mapped_vector` leaves named storage in place until
+        /// `remove()` is called.
+        template<typename T>
+        struct mapped_vector
+        {
+            static_assert(std::is_trivially_copyable<T>::value,
+                "The elements of a mapped_vector must be trivially copyable.");
+            static_assert(alignof(T) <= detail::mapped_header_size,
+                "The elements of a mapped_vector may not be over-aligned.");
+
+            using value_type = T;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using reference = T &;
+            using const_reference = T const &;
+            using pointer = T *;
+            using const_pointer = T const *;
+            using iterator = T *;
+            using const_iterator = T const *;
+        private:
+            detail::mapped_region region_;
+            T *data_;
+            std::size_t size_;
+            std::size_t capacity_;
+
+            void attach(std::size_t size)
+            {
+                data_ = reinterpret_cast<T *>(region_.data());
+                size_ = size;
+                capacity_ = (region_.bytes() - detail::mapped_header_size) / sizeof(T);
+            }
+            void set_size(std::size_t n) noexcept
+            {
+                size_ = n;
+                if(auto const h = region_.header())
+                    h->size = n;
+            }
+            bool aliases(T const *p) const noexcept
+            {
+                return std::less_equal<T const *>{}(data_, p) &&
+                    std::less<T const *>{}(p, data_ + capacity_);
+            }
+            template<typename I, CONCEPT_REQUIRES_(!ConvertibleTo<I, T const *>())>
+            bool aliases(I const &) const noexcept
+            {
+                return false;
+            }
+            void grow_to(std::size_t n)
+            {
+                RANGES_EXPECT(n <= max_size());
+                region_.grow(detail::mapped_header_size + n * sizeof(T));
+                this->attach(size_);
+            }
+            // Makes room for n more elements, growing geometrically.
+            void make_room(std::size_t n)
+            {
+                if(capacity_ - size_ < n)
+                    this->grow_to((std::max)(size_ + n, capacity_ * 2));
+            }
+            template<typename I, typename S>
+            iterator insert_(const_iterator pos, I first, S last, concepts::InputIterator *)
+            {
+                auto const off = static_cast<std::size_t>(pos - data_);
+                auto const old = size_;
+                for(; first != last; ++first)
+                    this->push_back(*first);
+                std::rotate(data_ + off, data_ + old, data_ + size_);
+                return data_ + off;
+            }
+            template<typename I, typename S>
+            iterator insert_(const_iterator pos, I first, S last, concepts::ForwardIterator *)
+            {
+                auto const off = static_cast<std::size_t>(pos - data_);
+                auto const n = static_cast<std::size_t>(ranges::distance(first, last));
+                this->make_room(n);
+                T *const p = data_ + off;
+                std::memmove(p + n, p, (size_ - off) * sizeof(T));
+                for(T *q = p; first != last; ++first, ++q)
+                    *q = *first;
+                this->set_size(size_ + n);
+                return p;
+            }
+        public:
+            /// Empty, in anonymous shared memory.
+            mapped_vector()
+              : region_(sizeof(T))
+            {
+                this->attach(0);
+            }
+            /// Creates or opens the storage called `name`.
+            mapped_vector(mapped_kind kind, std::string const &name,
+                mapped_mode mode = mapped_mode::create)
+              : region_(kind, name, mode, sizeof(T))
+            {
+                this->attach(static_cast<std::size_t>(region_.header()->size));
+            }
+            template<typename I, typename S,
+                CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>())>
+            mapped_vector(I first, S last)
+              : mapped_vector()
+            {
+                this->insert(end(), std::move(first), std::move(last));
+            }
+            mapped_vector(std::initializer_list<T> il)
+              : mapped_vector(il.begin(), il.end())
+            {}
+            mapped_vector(mapped_vector &&that) noexcept
+              : region_(std::move(that.region_)), data_(that.data_), size_(that.size_),
+                capacity_(that.capacity_)
+            {
+                that.data_ = nullptr, that.size_ = 0, that.capacity_ = 0;
+            }
+            mapped_vector &operator=(mapped_vector &&that) noexcept
+            {
+                this->swap(that);
+                return *this;
+            }
+            mapped_vector(mapped_vector const &) = delete;
+            mapped_vector &operator=(mapped_vector const &) = delete;
+
+            /// Removes the named storage. Processes that have it mapped keep
+            /// their mappings.
+            static void remove(mapped_kind kind, std::string const &name)
+            {
+                int const r = kind == mapped_kind::file ? ::unlink(name.c_str())
+                    : ::shm_unlink(name.c_str());
+                if(r == -1)
+                    detail::throw_mapped_error(kind == mapped_kind::file ? "unlink" : "shm_unlink");
+            }
+
+            iterator begin() noexcept { return data_; }
+            const_iterator begin() const noexcept { return data_; }
+            iterator end() noexcept { return data_ + size_; }
+            const_iterator end() const noexcept { return data_ + size_; }
+            T *data() noexcept { return data_; }
+            T const *data() const noexcept { return data_; }
+            size_type size() const noexcept { return size_; }
+            size_type capacity() const noexcept { return capacity_; }
+            bool empty() const noexcept { return size_ == 0; }
+            size_type max_size() const noexcept
+            {
+                return (std::size_t(PTRDIFF_MAX) - detail::mapped_header_size) / sizeof(T);
+            }
+            reference operator[](size_type i) noexcept
+            {
+                return RANGES_EXPECT(i < size_), data_[i];
+            }
+            const_reference operator[](size_type i) const noexcept
+            {
+                return RANGES_EXPECT(i < size_), data_[i];
+            }
+            reference front() noexcept { return (*this)[0]; }
+            const_reference front() const noexcept { return (*this)[0]; }
+            reference back() noexcept { return (*this)[size_ - 1]; }
+            const_reference back() const noexcept { return (*this)[size_ - 1]; }
+
+            /// The descriptor of the underlying storage.
+            int native_handle() const noexcept
+            {
+                return region_.fd();
+            }
+
+            void reserve(size_type n)
+            {
+                if(n > capacity_)
+                    this->grow_to(n);
+            }
+            void resize(size_type n, T const &t = T())
+            {
+                if(n > size_)
+                {
+                    T const tmp = t;
+                    this->reserve(n);
+                    std::fill(data_ + size_, data_ + n, tmp);
+                }
+                this->set_size(n);
+            }
+            void clear() noexcept
+            {
+                this->set_size(0);
+            }
+            void push_back(T const &t)
+            {
+                T const tmp = t;
+                this->make_room(1);
+                data_[size_] = tmp;
+                this->set_size(size_ + 1);
+            }
+            template<typename... Args>
+            reference emplace_back(Args &&... args)
+            {
+                this->push_back(T(static_cast<Args &&>(args)...));
+                return back();
+            }
+            void pop_back() noexcept
+            {
+                RANGES_EXPECT(size_ != 0);
+                this->set_size(size_ - 1);
+            }
+            iterator insert(const_iterator pos, T const &t)
+            {
+                return this->insert(pos, &t, &t + 1);
+            }
+            template<typename I, typename S,
+                CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>())>
+            iterator insert(const_iterator pos, I first, S last)
+            {
+                RANGES_EXPECT(data_ <= pos && pos <= data_ + size_);
+                // Elements of this container move when it grows, so copy
+                // them out first.
+                if(this->aliases(first))
+                {
+                    std::vector<T> tmp(first, last);
+                    return this->insert_(pos, tmp.data(), tmp.data() + tmp.size(),
+                        iterator_concept<T *>());
+                }
+                return this->insert_(pos, std::move(first), std::move(last),
+                    iterator_concept<I>());
+            }
+            iterator insert(const_iterator pos, std::initializer_list<T> il)
+            {
+                return this->insert(pos, il.begin(), il.end());
+            }
+            template<typename I, typename S,
+                CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>())>
+            void assign(I first, S last)
+            {
+                this->clear();
+                this->insert(end(), std::move(first), std::move(last));
+            }
+            iterator erase(const_iterator first, const_iterator last) noexcept
+            {
+                RANGES_EXPECT(data_ <= first && first <= last && last <= data_ + size_);
+                auto const off = first - data_;
+                auto const n = static_cast<std::size_t>(last - first);
+                std::memmove(data_ + off, last, static_cast<std::size_t>(end() - last) * sizeof(T));
+                this->set_size(size_ - n);
+                return data_ + off;
+            }
+            iterator erase(const_iterator pos) noexcept
+            {
+                return this->erase(pos, pos + 1);
+            }
+
+            /// Picks up elements that another process appended to the
+            /// storage, mapping more of it if it grew.
+            void refresh()
+            {
+                auto const n = static_cast<std::size_t>(region_.header()->size);
+                if(detail::mapped_header_size + n * sizeof(T) > region_.bytes())
+                    region_.remap(region_.storage_bytes());
+                this->attach(n);
+            }
+            /// Writes the elements of file-backed storage to disk.
+            void sync() const
+            {
+                region_.sync();
+            }
+
+            void swap(mapped_vector &that) noexcept
+            {
+                std::swap(region_, that.region_);
+                std::swap(data_, that.data_);
+                std::swap(size_, that.size_);
+                std::swap(capacity_, that.capacity_);
+            }
+            friend void swap(mapped_vector &x, mapped_vector &y) noexcept
+            {
+                x.swap(y);
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
@@ -16,5 +16,6 @@
 #include <range/v3/numeric/iota.hpp>
 #include <range/v3/numeric/inner_product.hpp>
 #include <range/v3/numeric/partial_sum.hpp>
+#include <range/v3/numeric/reassociate.hpp>
 
 #endif
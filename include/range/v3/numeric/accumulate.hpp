@@ -17,6 +17,7 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/numeric/reassociate.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
@@ -32,6 +33,47 @@ namespace ranges
             IndirectInvocable<Op, T *, projected<I, P>>,
             Assignable<T&, indirect_result_of_t<Op&(T *, projected<I, P>)>>>;
 
+        /// \cond
+        namespace detail
+        {
+            template<typename I, typename S, typename Op, typename P>
+            struct accumulate_cursor
+            {
+                I begin;
+                S end;
+                Op &op;
+                P &proj;
+
+                bool done() const
+                {
+                    return begin == end;
+                }
+                template<typename J = I, CONCEPT_REQUIRES_(SizedSentinel<S, J>())>
+                std::ptrdiff_t remaining() const
+                {
+                    return static_cast<std::ptrdiff_t>(end - begin);
+                }
+                template<typename J = I, CONCEPT_REQUIRES_(!SizedSentinel<S, J>())>
+                std::ptrdiff_t remaining() const
+                {
+                    return -1;
+                }
+                template<typename T>
+                void first(T &acc)
+                {
+                    acc = invoke(proj, *begin);
+                    ++begin;
+                }
+                template<typename T>
+                void next(T &acc)
+                {
+                    acc = invoke(op, acc, invoke(proj, *begin));
+                    ++begin;
+                }
+            };
+        }
+        /// \endcond
+
         struct accumulate_fn
         {
             template<typename I, typename S, typename T, typename Op = plus, typename P = ident,
@@ -51,6 +93,40 @@ namespace ranges
                 return (*this)(begin(rng), end(rng), std::move(init), std::move(op),
                     std::move(proj));
             }
+
+            /// Accumulates in an unspecified order determined by \p mode, treating
+            /// \p op as associative and commutative.
+            /// \sa `unseq_t`, `pairwise_t`, `reproducible_t`
+            template<typename Mode, typename I, typename S, typename T, typename Op = plus,
+                typename P = ident,
+                CONCEPT_REQUIRES_(ReassociationMode<Mode>() && Sentinel<S, I>() &&
+                    Accumulateable<I, T, Op, P>() && Copyable<T>() &&
+                    Assignable<T&, indirect_result_of_t<P&(I)>>())>
+            T operator()(Mode, I begin, S end, T init, Op op = Op{}, P proj = P{}) const
+            {
+                detail::accumulate_cursor<I, S, Op, P> cur{std::move(begin), std::move(end),
+                    op, proj};
+                return detail::reassociate_reduce(std::move(init), op, cur,
+                    detail::blocked_mode<Mode>());
+            }
+
+            /// \overload
+            /// Ranges with a small static extent, such as `span<float, 16>`,
+            /// are reduced with constant trip counts.
+            template<typename Mode, typename Rng, typename T, typename Op = plus,
+                typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(ReassociationMode<Mode>() && Range<Rng>() &&
+                    Accumulateable<I, T, Op, P>() && Copyable<T>() &&
+                    Assignable<T&, indirect_result_of_t<P&(I)>>())>
+            T operator()(Mode, Rng && rng, T init, Op op = Op{}, P proj = P{}) const
+            {
+                detail::accumulate_cursor<I, range_sentinel_t<Rng>, Op, P> cur{begin(rng),
+                    end(rng), op, proj};
+                return detail::reassociate_reduce(std::move(init), op, cur,
+                    detail::reassociate_kernel<Mode,
+                        static_cast<std::ptrdiff_t>(range_cardinality<Rng>::value)>());
+            }
         };
 
         RANGES_INLINE_VARIABLE(with_braced_init_args<accumulate_fn>, accumulate)
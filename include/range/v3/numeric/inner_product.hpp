@@ -18,10 +18,12 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/numeric/reassociate.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/unreachable.hpp>
 
 namespace ranges
 {
@@ -45,6 +47,81 @@ namespace ranges
             Invocable<BOp1&, T, Y2>,
             Assignable<T&, Y2>>;
 
+        /// \cond
+        namespace detail
+        {
+            template<typename I1, typename S1, typename I2, typename S2,
+                typename BOp1, typename BOp2, typename P1, typename P2, typename Fused>
+            struct inner_product_cursor
+            {
+                I1 begin1;
+                S1 end1;
+                I2 begin2;
+                S2 end2;
+                BOp1 &bop1;
+                BOp2 &bop2;
+                P1 &proj1;
+                P2 &proj2;
+
+                bool done() const
+                {
+                    return begin1 == end1 || begin2 == end2;
+                }
+                template<typename J1 = I1, typename J2 = I2,
+                    CONCEPT_REQUIRES_(SizedSentinel<S1, J1>() && SizedSentinel<S2, J2>())>
+                std::ptrdiff_t remaining() const
+                {
+                    auto const n1 = static_cast<std::ptrdiff_t>(end1 - begin1);
+                    auto const n2 = static_cast<std::ptrdiff_t>(end2 - begin2);
+                    return n1 < n2 ? n1 : n2;
+                }
+                template<typename J1 = I1, typename J2 = I2,
+                    CONCEPT_REQUIRES_(SizedSentinel<S1, J1>() && Same<S2, unreachable>())>
+                std::ptrdiff_t remaining() const
+                {
+                    return static_cast<std::ptrdiff_t>(end1 - begin1);
+                }
+                template<typename J1 = I1, typename J2 = I2,
+                    CONCEPT_REQUIRES_(!(SizedSentinel<S1, J1>() &&
+                        (SizedSentinel<S2, J2>() || Same<S2, unreachable>())))>
+                std::ptrdiff_t remaining() const
+                {
+                    return -1;
+                }
+                template<typename T>
+                void first(T &acc)
+                {
+                    acc = invoke(bop2, invoke(proj1, *begin1), invoke(proj2, *begin2));
+                    ++begin1;
+                    ++begin2;
+                }
+                template<typename T>
+                void next(T &acc)
+                {
+                    detail::reassociate_fma(acc, bop1, bop2, invoke(proj1, *begin1),
+                        invoke(proj2, *begin2), Fused());
+                    ++begin1;
+                    ++begin2;
+                }
+            };
+
+            // The number of terms, if both ranges have a static extent;
+            // otherwise negative.
+            template<typename Rng1, typename Rng2,
+                std::ptrdiff_t N1 = static_cast<std::ptrdiff_t>(range_cardinality<Rng1>::value),
+                std::ptrdiff_t N2 = static_cast<std::ptrdiff_t>(range_cardinality<Rng2>::value)>
+            using inner_product_extent = std::integral_constant<std::ptrdiff_t,
+                N1 < 0 || N2 < 0 ? -1 : N1 < N2 ? N1 : N2>;
+
+            template<typename Mode, typename T, typename BOp1, typename BOp2>
+            using inner_product_fused = meta::bool_<
+                fused_mode<Mode>::value &&
+                std::is_floating_point<T>::value &&
+                std::is_same<BOp1, plus>::value &&
+                std::is_same<BOp2, multiplies>::value>;
+        }
+        /// \endcond
+
         struct inner_product_fn
         {
             template<typename I1, typename S1, typename I2, typename T,
@@ -108,6 +185,76 @@ namespace ranges
                 return (*this)(begin(rng1), end(rng1), begin(rng2), end(rng2), std::move(init),
                     std::move(bop1), std::move(bop2),  std::move(proj1), std::move(proj2));
             }
+
+            /// Computes the inner product in an unspecified order determined by
+            /// \p mode, treating \p bop1 as associative and commutative.
+            /// \sa `unseq_t`, `pairwise_t`, `reproducible_t`
+            template<typename Mode, typename I1, typename S1, typename I2, typename T,
+                typename BOp1 = plus, typename BOp2 = multiplies,
+                typename P1 = ident, typename P2 = ident,
+                CONCEPT_REQUIRES_(
+                    ReassociationMode<Mode>() &&
+                    Sentinel<S1, I1>() &&
+                    InnerProductable<I1, I2, T, BOp1, BOp2, P1, P2>() &&
+                    Copyable<T>()
+                )>
+            T operator()(Mode, I1 begin1, S1 end1, I2 begin2, T init, BOp1 bop1 = BOp1{},
+                BOp2 bop2 = BOp2{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                detail::inner_product_cursor<I1, S1, I2, unreachable, BOp1, BOp2, P1, P2,
+                    detail::inner_product_fused<Mode, T, BOp1, BOp2>> cur{std::move(begin1),
+                        std::move(end1), std::move(begin2), unreachable{}, bop1, bop2, proj1,
+                        proj2};
+                return detail::reassociate_reduce(std::move(init), bop1, cur,
+                    detail::blocked_mode<Mode>());
+            }
+
+            /// \overload
+            template<typename Mode, typename I1, typename S1, typename I2, typename S2,
+                typename T, typename BOp1 = plus, typename BOp2 = multiplies,
+                typename P1 = ident, typename P2 = ident,
+                CONCEPT_REQUIRES_(
+                    ReassociationMode<Mode>() &&
+                    Sentinel<S1, I1>() &&
+                    Sentinel<S2, I2>() &&
+                    InnerProductable<I1, I2, T, BOp1, BOp2, P1, P2>() &&
+                    Copyable<T>()
+                )>
+            T operator()(Mode, I1 begin1, S1 end1, I2 begin2, S2 end2, T init,
+                BOp1 bop1 = BOp1{}, BOp2 bop2 = BOp2{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                detail::inner_product_cursor<I1, S1, I2, S2, BOp1, BOp2, P1, P2,
+                    detail::inner_product_fused<Mode, T, BOp1, BOp2>> cur{std::move(begin1),
+                        std::move(end1), std::move(begin2), std::move(end2), bop1, bop2, proj1,
+                        proj2};
+                return detail::reassociate_reduce(std::move(init), bop1, cur,
+                    detail::blocked_mode<Mode>());
+            }
+
+            /// \overload
+            template<typename Mode, typename Rng1, typename Rng2, typename T,
+                typename BOp1 = plus, typename BOp2 = multiplies,
+                typename P1 = ident, typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = range_iterator_t<Rng2>,
+                CONCEPT_REQUIRES_(
+                    ReassociationMode<Mode>() &&
+                    Range<Rng1>() &&
+                    Range<Rng2>() &&
+                    InnerProductable<I1, I2, T, BOp1, BOp2, P1, P2>() &&
+                    Copyable<T>()
+                )>
+            T operator()(Mode, Rng1 && rng1, Rng2 && rng2, T init, BOp1 bop1 = BOp1{},
+                BOp2 bop2 = BOp2{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                detail::inner_product_cursor<I1, range_sentinel_t<Rng1>, I2,
+                    range_sentinel_t<Rng2>, BOp1, BOp2, P1, P2,
+                    detail::inner_product_fused<Mode, T, BOp1, BOp2>> cur{begin(rng1),
+                        end(rng1), begin(rng2), end(rng2), bop1, bop2, proj1, proj2};
+                return detail::reassociate_reduce(std::move(init), bop1, cur,
+                    detail::reassociate_kernel<Mode,
+                        detail::inner_product_extent<Rng1, Rng2>::value>());
+            }
         };
 
         RANGES_INLINE_VARIABLE(with_braced_init_args<inner_product_fn>,
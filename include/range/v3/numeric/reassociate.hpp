@@ -0,0 +1,315 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_NUMERIC_REASSOCIATE_HPP
+#define RANGES_V3_NUMERIC_REASSOCIATE_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-numerics
+        /// @{
+
+        /// Reassociation modes for `accumulate` and `inner_product`. Passing one
+        /// of these as the first argument asserts that the reduction operation
+        /// is associative and commutative (as `plus` is for floating point, up to
+        /// rounding), which lets the reduction be split into independent chains
+        /// that the compiler can vectorize.
+
+        /// Fastest: `reassociate_lanes` interleaved accumulators, with fused
+        /// multiply-adds in `inner_product` where the target supports them.
+        struct unseq_t {};
+
+        /// Pairwise (cascade) summation: blocks of `reassociate_block` terms are
+        /// reduced as with `unseq`, fused multiply-adds included, and the block
+        /// results are combined in a balanced tree, so rounding error grows with
+        /// log(N) rather than N.
+        struct pairwise_t {};
+
+        /// Like `pairwise`, but never introduces fused multiply-adds. The
+        /// association order depends only on the number of terms, so results are
+        /// bit-identical across targets and vector widths (given the same
+        /// floating-point contraction settings).
+        struct reproducible_t {};
+
+        /// \sa `unseq_t`
+        RANGES_INLINE_VARIABLE(unseq_t, unseq)
+
+        /// \sa `pairwise_t`
+        RANGES_INLINE_VARIABLE(pairwise_t, pairwise)
+
+        /// \sa `reproducible_t`
+        RANGES_INLINE_VARIABLE(reproducible_t, reproducible)
+
+        /// The number of independent accumulators. This is fixed rather than
+        /// derived from the target's vector width so that results do not change
+        /// from one instruction set to another.
+        constexpr int reassociate_lanes = 8;
+
+        /// The number of terms reduced together before pairwise combination.
+        constexpr std::ptrdiff_t reassociate_block = 256;
+
+        template<typename T>
+        using ReassociationMode = meta::or_<
+            std::is_same<T, unseq_t>,
+            std::is_same<T, pairwise_t>,
+            std::is_same<T, reproducible_t>>;
+        /// @}
+
+        /// \cond
+        namespace detail
+        {
+            template<typename Mode>
+            using fused_mode = meta::not_<std::is_same<Mode, reproducible_t>>;
+
+            template<typename Mode>
+            using blocked_mode = meta::not_<std::is_same<Mode, unseq_t>>;
+
+            // How reassociate_reduce handles a range with N elements, where N
+            // is known statically or is negative: small ranges get a kernel
+            // with constant trip counts, which the compiler unrolls.
+            template<typename Mode, std::ptrdiff_t N>
+            using reassociate_kernel = meta::if_c<
+                0 <= N && N <= reassociate_block,
+                std::integral_constant<std::ptrdiff_t, N>,
+                blocked_mode<Mode>>;
+
+            // x * y + z, fused when the target has a fast fused multiply-add for
+            // the type.
+            inline float fast_fma(float x, float y, float z)
+            {
+            #ifdef FP_FAST_FMAF
+                return std::fma(x, y, z);
+            #else
+                return x * y + z;
+            #endif
+            }
+            inline double fast_fma(double x, double y, double z)
+            {
+            #ifdef FP_FAST_FMA
+                return std::fma(x, y, z);
+            #else
+                return x * y + z;
+            #endif
+            }
+            inline long double fast_fma(long double x, long double y, long double z)
+            {
+            #ifdef FP_FAST_FMAL
+                return std::fma(x, y, z);
+            #else
+                return x * y + z;
+            #endif
+            }
+
+            // acc = op1(acc, op2(x, y)), as a single fused multiply-add when that
+            // is both allowed and cheap.
+            template<typename T, typename Op1, typename Op2, typename X, typename Y>
+            void reassociate_fma(T &acc, Op1 &op1, Op2 &op2, X &&x, Y &&y, std::false_type)
+            {
+                acc = invoke(op1, acc, invoke(op2, (X &&) x, (Y &&) y));
+            }
+            template<typename T, typename X, typename Y>
+            void reassociate_fma(T &acc, plus &, multiplies &, X &&x, Y &&y, std::true_type)
+            {
+                acc = detail::fast_fma(static_cast<T>(x), static_cast<T>(y), acc);
+            }
+
+            // Room for N accumulators that are constructed only when first set,
+            // so that the value type need not be default constructible.
+            template<typename T, int N>
+            struct reassociate_array
+            {
+            private:
+                typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type storage_;
+                bool live_[N];
+            public:
+                reassociate_array()
+                  : live_()
+                {}
+                reassociate_array(reassociate_array const &) = delete;
+                reassociate_array &operator=(reassociate_array const &) = delete;
+                ~reassociate_array()
+                {
+                    for(int i = 0; i < N; ++i)
+                        reset(i);
+                }
+                T &operator[](int i) noexcept
+                {
+                    return static_cast<T *>(static_cast<void *>(&storage_))[i];
+                }
+                bool live(int i) const noexcept
+                {
+                    return live_[i];
+                }
+                template<typename U>
+                void set(int i, U &&u)
+                {
+                    if(live_[i])
+                        (*this)[i] = static_cast<U &&>(u);
+                    else
+                    {
+                        ::new(static_cast<void *>(&(*this)[i])) T(static_cast<U &&>(u));
+                        live_[i] = true;
+                    }
+                }
+                void reset(int i) noexcept
+                {
+                    if(live_[i])
+                    {
+                        (*this)[i].~T();
+                        live_[i] = false;
+                    }
+                }
+            };
+
+            // Combines lanes [0, n) in a fixed balanced tree.
+            template<typename T, int N, typename Op>
+            T &reassociate_combine(reassociate_array<T, N> &acc, int n, Op &op)
+            {
+                for(int width = 1; width < n; width *= 2)
+                    for(int i = 0; i + width < n; i += 2 * width)
+                        acc[i] = invoke(op, acc[i], acc[i + width]);
+                return acc[0];
+            }
+
+            // Reduces at most `n` terms (all remaining terms if n < 0) from `cur`
+            // into `out[0]` using reassociate_lanes interleaved accumulators, each
+            // a copy of `seed` before its first term is assigned. Returns false
+            // if `cur` was already exhausted. Cur must provide:
+            //  - bool done() const
+            //  - std::ptrdiff_t remaining() const, or -1 when unknown
+            //  - void first(T &acc): acc = term; advance
+            //  - void next(T &acc): acc = op(acc, term); advance
+            template<typename T, typename Op, typename Cur>
+            bool reassociate_lanes_reduce(reassociate_array<T, 1> &out, T const &seed, Op &op,
+                Cur &cur, std::ptrdiff_t n)
+            {
+                reassociate_array<T, reassociate_lanes> acc;
+                int filled = 0;
+                for(; filled < reassociate_lanes && n != 0 && !cur.done(); ++filled, --n)
+                {
+                    acc.set(filled, seed);
+                    cur.first(acc[filled]);
+                }
+                if(filled == 0)
+                    return false;
+                if(filled == reassociate_lanes)
+                {
+                    std::ptrdiff_t known = cur.remaining();
+                    if(known >= 0)
+                    {
+                        // The trip count is known, so the inner loop has no
+                        // end test and can be vectorized.
+                        if(n >= 0 && n < known)
+                            known = n;
+                        std::ptrdiff_t const bulk = known - known % reassociate_lanes;
+                        for(std::ptrdiff_t k = 0; k < bulk; k += reassociate_lanes)
+                            for(int j = 0; j < reassociate_lanes; ++j)
+                                cur.next(acc[j]);
+                        if(n >= 0)
+                            n -= bulk;
+                    }
+                    for(int j = 0; n != 0 && !cur.done(); --n)
+                    {
+                        cur.next(acc[j]);
+                        j = j + 1 == reassociate_lanes ? 0 : j + 1;
+                    }
+                }
+                out.set(0, std::move(reassociate_combine(acc, filled, op)));
+                return true;
+            }
+
+            template<typename T, typename Op, typename Cur>
+            T reassociate_reduce(T init, Op &op, Cur &cur, std::false_type /*blocked*/)
+            {
+                reassociate_array<T, 1> sum;
+                if(reassociate_lanes_reduce(sum, init, op, cur, -1))
+                    init = invoke(op, init, sum[0]);
+                return init;
+            }
+
+            // Reduces exactly N <= reassociate_block terms, associating them as
+            // reassociate_lanes_reduce does, so the result is the same in every
+            // mode.
+            template<typename T, typename Op, typename Cur, std::ptrdiff_t N>
+            T reassociate_reduce(T init, Op &op, Cur &cur,
+                std::integral_constant<std::ptrdiff_t, N>)
+            {
+                constexpr int filled = N < reassociate_lanes ? static_cast<int>(N)
+                    : reassociate_lanes;
+                if(filled == 0)
+                    return init;
+                reassociate_array<T, reassociate_lanes> acc;
+                for(int j = 0; j < filled; ++j)
+                {
+                    acc.set(j, init);
+                    cur.first(acc[j]);
+                }
+                for(std::ptrdiff_t k = filled; k < N; k += reassociate_lanes)
+                    for(int j = 0; j < reassociate_lanes && k + j < N; ++j)
+                        cur.next(acc[j]);
+                return invoke(op, init, reassociate_combine(acc, filled, op));
+            }
+
+            template<typename T, typename Op, typename Cur>
+            T reassociate_reduce(T init, Op &op, Cur &cur, std::true_type /*blocked*/)
+            {
+                // A binary counter of block sums: level[i] holds the sum of 2^i
+                // blocks when it is live. Each new block carries up the
+                // counter, which yields the same tree as recursive halving.
+                reassociate_array<T, 64> level;
+                int top = 0;
+                reassociate_array<T, 1> sum;
+                while(reassociate_lanes_reduce(sum, init, op, cur, reassociate_block))
+                {
+                    int i = 0;
+                    for(; level.live(i); ++i)
+                    {
+                        sum[0] = invoke(op, level[i], sum[0]);
+                        level.reset(i);
+                    }
+                    level.set(i, std::move(sum[0]));
+                    top = i + 1 > top ? i + 1 : top;
+                }
+                bool any = false;
+                for(int i = 0; i < top; ++i)
+                {
+                    if(!level.live(i))
+                        continue;
+                    if(any)
+                        sum[0] = invoke(op, level[i], sum[0]);
+                    else
+                        sum.set(0, level[i]);
+                    any = true;
+                }
+                if(any)
+                    init = invoke(op, init, sum[0]);
+                return init;
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
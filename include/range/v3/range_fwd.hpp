@@ -457,6 +457,32 @@ namespace ranges
             struct all_fn;
         }
 
+        enum class category
+        {
+            input,
+            forward,
+            bidirectional,
+            random_access
+        };
+
+        template<typename Ref, category Cat = category::input>
+        struct any_view;
+
+        /// \cond
+        namespace detail
+        {
+            template<typename T>
+            struct is_any_view
+              : std::false_type
+            {};
+
+            template<typename Ref, category Cat>
+            struct is_any_view<any_view<Ref, Cat>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
         template<typename Rng>
         struct bounded_view;
 
@@ -691,6 +717,19 @@ namespace ranges
         template<typename Rng, typename Fun>
         struct transform_view;
 
+        template<typename Rng1, typename Rng2, typename Fun>
+        struct iter_transform2_view;
+
+        template<typename Rng1, typename Rng2, typename Fun>
+        struct transform2_view;
+
+        /// \cond
+        namespace detail
+        {
+            struct elementwise_access;
+        }
+        /// \endcond
+
         namespace view
         {
             struct transform_fn;
@@ -15,6 +15,7 @@
 #define RANGES_V3_SPAN_HPP
 
 #include <cstddef>
+#include <cstdint>
 #include <meta/meta.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/data.hpp>
@@ -49,6 +50,18 @@ namespace ranges
                     : n * static_cast<std::ptrdiff_t>(sizeof(T));
             }
 
+            // Tells the compiler that p is a multiple of Align, so that code
+            // using it can skip alignment peeling.
+            template<std::size_t Align, typename T>
+            T *assume_aligned(T *p) noexcept
+            {
+            #if defined(__GNUC__) || defined(__clang__)
+                return static_cast<T *>(__builtin_assume_aligned(p, Align));
+            #else
+                return p;
+            #endif
+            }
+
             template<typename T, std::ptrdiff_t N>
             class span_base
             {
@@ -231,6 +244,82 @@ namespace ranges
         template<typename T, std::ptrdiff_t N>
         constexpr std::ptrdiff_t span<T, N>::extent;
 
+        /// A `span` whose first element is aligned to `Align` bytes. Its
+        /// `data()` and `begin()` carry that alignment to the compiler, so
+        /// loops that are inlined into the caller, such as the generic
+        /// algorithms and the reassociating numeric kernels, can use aligned
+        /// vector loads without peeling off a misaligned head. Alignment is
+        /// a precondition of construction. Together with a static extent,
+        /// the whole trip count of a kernel is known at compile time.
+        ///
+        /// The alignment is only a hint to the auto-vectorizer. The
+        /// processor-specific kernels in `cpu_dispatch.hpp` are called
+        /// through function pointers with plain `T *` arguments and use
+        /// unaligned loads, so they neither see nor need it.
+        template<typename T, std::size_t Align, std::ptrdiff_t N = dynamic_extent>
+        class aligned_span
+          : public span<T, N>
+        {
+            CONCEPT_ASSERT(Align != 0 && (Align & (Align - 1)) == 0);
+            CONCEPT_ASSERT(Align >= alignof(T));
+
+            using base_t = span<T, N>;
+
+            static bool is_aligned(T const *p) noexcept
+            {
+                return reinterpret_cast<std::uintptr_t>(p) % Align == 0;
+            }
+        public:
+            using typename base_t::index_type;
+            using typename base_t::pointer;
+            using typename base_t::iterator;
+
+            template<typename Rng>
+            using ConversionConstraint = typename base_t::template ConversionConstraint<Rng>;
+
+            static constexpr std::size_t alignment = Align;
+
+            aligned_span() = default;
+            aligned_span(pointer ptr, index_type count) noexcept
+              : base_t{(RANGES_EXPECT(is_aligned(ptr)), ptr), count}
+            {}
+            template<typename Int,
+                CONCEPT_REQUIRES_(SignedIntegral<Int>())>
+            aligned_span(pointer ptr, Int count) noexcept
+              : aligned_span{ptr, index_type{count}}
+            {}
+            template<typename Rng,
+                CONCEPT_REQUIRES_(ConversionConstraint<Rng>())>
+            explicit aligned_span(Rng && rng)
+              : aligned_span{ranges::data(rng), static_cast<index_type>(ranges::size(rng))}
+            {}
+
+            pointer data() const noexcept
+            {
+                return detail::assume_aligned<Align>(base_t::data());
+            }
+            iterator begin() const noexcept { return data(); }
+            iterator end() const noexcept { return data() + this->size(); }
+
+            template<std::ptrdiff_t Count,
+                CONCEPT_REQUIRES_(N == dynamic_extent || Count <= N)>
+            aligned_span<T, Align, Count> first() const noexcept
+            {
+                static_assert(0 <= Count,
+                    "Count of characters to extract cannot be negative.");
+                return RANGES_EXPECT(Count <= this->size()),
+                    aligned_span<T, Align, Count>{data(), Count};
+            }
+            aligned_span<T, Align> first(index_type count) const noexcept
+            {
+                return RANGES_EXPECT(0 <= count && count <= this->size()),
+                    aligned_span<T, Align>{data(), count};
+            }
+        };
+
+        template<typename T, std::size_t Align, std::ptrdiff_t N>
+        constexpr std::size_t aligned_span<T, Align, N>::alignment;
+
         // [span.comparison], span comparison operators
         template<class T, class U, std::ptrdiff_t N,
             CONCEPT_REQUIRES_(EqualityComparable<T, U>())>
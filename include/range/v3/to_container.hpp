@@ -14,10 +14,14 @@
 #ifndef RANGES_V3_TO_CONTAINER_HPP
 #define RANGES_V3_TO_CONTAINER_HPP
 
+#include <cstddef>
+#include <type_traits>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/data.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/utility/elementwise.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/action/concepts.hpp>
 
@@ -57,6 +61,17 @@ namespace ranges
                         ReserveAndAssignable<C, range_common_iterator_t<R>>,
                         SizedRange<R>>;
 
+                // Elementwise expressions are evaluated with a flat indexed loop
+                // into a container of the right size.
+                template <typename C, typename R>
+                using ElementwiseConcept =
+                    meta::strict_and<
+                        ElementwiseExpression<R>,
+                        ContiguousRange<C>,
+                        std::is_constructible<C, std::size_t>>;
+
+                struct elementwise_tag {};
+
                 template<typename Rng,
                     typename Cont = meta::invoke<ContainerMetafunctionClass, range_value_t<Rng>>,
                     CONCEPT_REQUIRES_(Range<Rng>() && detail::ConvertibleToContainer<Rng, Cont>())>
@@ -80,6 +95,17 @@ namespace ranges
                     return c;
                 }
 
+                template<typename Rng,
+                    typename Cont = meta::invoke<ContainerMetafunctionClass, range_value_t<Rng>>,
+                    CONCEPT_REQUIRES_(Range<Rng>() && detail::ConvertibleToContainer<Rng, Cont>() &&
+                                      ElementwiseConcept<Cont, Rng>())>
+                Cont impl(Rng && rng, elementwise_tag) const
+                {
+                    Cont c(static_cast<std::size_t>(size(rng)));
+                    detail::elementwise_copy(rng, data(c));
+                    return c;
+                }
+
             public:
                 template<typename Rng,
                     typename Cont = meta::invoke<ContainerMetafunctionClass, range_value_t<Rng>>,
@@ -88,7 +114,8 @@ namespace ranges
                 {
                     static_assert(!is_infinite<Rng>::value,
                         "Attempt to convert an infinite range to a container.");
-                    return impl(std::forward<Rng>(rng), ReserveConcept<Cont, Rng>());
+                    return impl(std::forward<Rng>(rng), meta::if_<ElementwiseConcept<Cont, Rng>,
+                        elementwise_tag, ReserveConcept<Cont, Rng>>{});
                 }
             };
         }
@@ -0,0 +1,158 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_TO_STRING_HPP
+#define RANGES_V3_TO_STRING_HPP
+
+#include <string>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/data.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/empty.hpp>
+#include <range/v3/view/join.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            struct to_string_fn
+              : pipeable<to_string_fn>
+            {
+            private:
+                template<typename Rng>
+                using Contiguous_ = meta::strict_and<SizedRange<Rng>, ContiguousRange<Rng>>;
+
+                template<typename Rng, typename Sep>
+                using JoinReservable_ = meta::strict_and<
+                    ForwardRange<Rng>,
+                    SizedRange<range_reference_t<Rng>>,
+                    SizedRange<Sep>>;
+
+                // Contiguous pieces are copied with a single bulk append.
+                template<typename Str, typename Rng,
+                    CONCEPT_REQUIRES_(Contiguous_<Rng>())>
+                static void append(Str &str, Rng &rng, priority_tag<1>)
+                {
+                    str.append(ranges::data(rng), static_cast<std::size_t>(ranges::size(rng)));
+                }
+                template<typename Str, typename Rng>
+                static void append(Str &str, Rng &rng, priority_tag<0>)
+                {
+                    for(auto it = ranges::begin(rng), e = ranges::end(rng); it != e; ++it)
+                        str.push_back(*it);
+                }
+                template<typename Str, typename Rng>
+                static void append(Str &str, Rng &rng)
+                {
+                    to_string_fn::append(str, rng, priority_tag<1>{});
+                }
+
+                template<typename Str, typename Rng,
+                    CONCEPT_REQUIRES_(SizedRange<Rng>())>
+                static void reserve(Str &str, Rng &rng)
+                {
+                    str.reserve(static_cast<std::size_t>(ranges::size(rng)));
+                }
+                template<typename Str, typename Rng,
+                    CONCEPT_REQUIRES_(!SizedRange<Rng>())>
+                static void reserve(Str &, Rng &)
+                {}
+
+                // Walk the outer range once to compute the length of the joined
+                // string so that it can be built with a single allocation.
+                template<typename Str, typename Rng, typename Sep,
+                    CONCEPT_REQUIRES_(JoinReservable_<Rng, Sep>())>
+                static void reserve_join(Str &str, Rng &rng, Sep &sep)
+                {
+                    std::size_t n = 0, count = 0;
+                    for(auto it = ranges::begin(rng), e = ranges::end(rng); it != e; ++it, ++count)
+                        n += static_cast<std::size_t>(ranges::size(*it));
+                    if(count != 0)
+                        n += (count - 1) * static_cast<std::size_t>(ranges::size(sep));
+                    str.reserve(n);
+                }
+                template<typename Str, typename Rng, typename Sep,
+                    CONCEPT_REQUIRES_(!JoinReservable_<Rng, Sep>())>
+                static void reserve_join(Str &, Rng &, Sep &)
+                {}
+
+                template<typename Str, typename Rng>
+                static void impl(Str &str, Rng &rng, priority_tag<0>)
+                {
+                    to_string_fn::reserve(str, rng);
+                    to_string_fn::append(str, rng);
+                }
+                template<typename Str, typename Rng>
+                static void impl(Str &str, join_view<Rng> &rng, priority_tag<1>)
+                {
+                    auto outer = rng.base();
+                    auto sep = view::empty<typename Str::value_type>();
+                    to_string_fn::reserve_join(str, outer, sep);
+                    for(auto it = ranges::begin(outer), e = ranges::end(outer); it != e; ++it)
+                    {
+                        auto &&inner = *it;
+                        to_string_fn::append(str, inner);
+                    }
+                }
+                template<typename Str, typename Rng, typename ValRng>
+                static void impl(Str &str, join_view<Rng, ValRng> &rng, priority_tag<1>)
+                {
+                    auto outer = rng.base();
+                    auto sep = rng.separator();
+                    to_string_fn::reserve_join(str, outer, sep);
+                    bool first = true;
+                    for(auto it = ranges::begin(outer), e = ranges::end(outer); it != e; ++it)
+                    {
+                        if(!first)
+                            to_string_fn::append(str, sep);
+                        first = false;
+                        auto &&inner = *it;
+                        to_string_fn::append(str, inner);
+                    }
+                }
+
+            public:
+                template<typename Rng,
+                    typename Char = range_value_t<Rng>,
+                    CONCEPT_REQUIRES_(InputRange<Rng>())>
+                std::basic_string<Char> operator()(Rng && rng) const
+                {
+                    static_assert(!is_infinite<Rng>::value,
+                        "Attempt to convert an infinite range to a string.");
+                    std::basic_string<Char> str;
+                    to_string_fn::impl(str, rng, priority_tag<1>{});
+                    return str;
+                }
+            };
+        }
+        /// \endcond
+
+        /// \ingroup group-core
+        /// Converts a range of characters into a `std::basic_string`. When the
+        /// length of the result can be computed up front, the string is allocated
+        /// once; contiguous pieces, including those of a `view::join`, are
+        /// copied in bulk.
+        RANGES_INLINE_VARIABLE(detail::to_string_fn, to_string)
+    }
+}
+
+#endif
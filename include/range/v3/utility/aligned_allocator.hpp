@@ -0,0 +1,100 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_ALIGNED_ALLOCATOR_HPP
+#define RANGES_V3_UTILITY_ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+#include <range/v3/range_fwd.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// An allocator whose blocks start on an `Align`-byte boundary, so that
+        /// a container using it can be viewed as an `aligned_span`:
+        /// \code
+        /// auto v = rng | to_<std::vector<float, aligned_allocator<float, 64>>>();
+        /// aligned_span<float, 64> s{v};
+        /// \endcode
+        /// Blocks come from `posix_memalign`, or `_aligned_malloc` on Windows.
+        template<typename T, std::size_t Align>
+        struct aligned_allocator
+        {
+            static_assert(Align != 0 && (Align & (Align - 1)) == 0,
+                "Align must be a power of two.");
+
+            using value_type = T;
+            template<typename U>
+            struct rebind
+            {
+                using other = aligned_allocator<U, Align>;
+            };
+
+            aligned_allocator() = default;
+            template<typename U>
+            constexpr aligned_allocator(aligned_allocator<U, Align> const &) noexcept
+            {}
+            T *allocate(std::size_t n)
+            {
+                if(n > (std::numeric_limits<std::size_t>::max)() / sizeof(T))
+                    throw std::bad_alloc{};
+                std::size_t const bytes = n == 0 ? sizeof(T) : n * sizeof(T);
+                std::size_t align = Align < alignof(T) ? alignof(T) : Align;
+            #if defined(_WIN32)
+                void *const p = ::_aligned_malloc(bytes, align);
+            #else
+                if(align < sizeof(void *))
+                    align = sizeof(void *);
+                void *p = nullptr;
+                if(::posix_memalign(&p, align, bytes) != 0)
+                    p = nullptr;
+            #endif
+                if(!p)
+                    throw std::bad_alloc{};
+                return static_cast<T *>(p);
+            }
+            void deallocate(T *p, std::size_t) noexcept
+            {
+            #if defined(_WIN32)
+                ::_aligned_free(p);
+            #else
+                std::free(p);
+            #endif
+            }
+            template<typename U>
+            friend constexpr bool operator==(aligned_allocator const &,
+                aligned_allocator<U, Align> const &) noexcept
+            {
+                return true;
+            }
+            template<typename U>
+            friend constexpr bool operator!=(aligned_allocator const &,
+                aligned_allocator<U, Align> const &) noexcept
+            {
+                return false;
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
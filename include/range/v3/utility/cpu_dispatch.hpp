@@ -0,0 +1,616 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_CPU_DISPATCH_HPP
+#define RANGES_V3_UTILITY_CPU_DISPATCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && \
+    !defined(__clang__) && !defined(RANGES_DISABLE_CPU_DISPATCH)
+#define RANGES_CPU_DISPATCH 1
+#include <immintrin.h>
+#else
+#define RANGES_CPU_DISPATCH 0
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// Instruction sets with their own kernels for `find`, `count`,
+        /// `equal`, `search`, `search_n`, `min_element` and `max_element` over
+        /// contiguous ranges of integers, for `find_first_of` over contiguous
+        /// ranges of bytes, and for `copy_if`, `replace`, `replace_if`,
+        /// `reverse`, `swap_ranges` and `transform` over contiguous ranges of
+        /// arithmetic values.
+        /// `baseline` uses the portable loops.
+        enum class cpu_isa
+        {
+            baseline,
+            sse42,
+            avx2,
+            avx512
+        };
+
+        /// The best instruction set the processor supports.
+        inline cpu_isa detected_cpu_isa()
+        {
+        #if RANGES_CPU_DISPATCH
+            static cpu_isa const isa = []
+            {
+                __builtin_cpu_init();
+                if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+                    return cpu_isa::avx512;
+                if(__builtin_cpu_supports("avx2"))
+                    return cpu_isa::avx2;
+                if(__builtin_cpu_supports("sse4.2"))
+                    return cpu_isa::sse42;
+                return cpu_isa::baseline;
+            }();
+            return isa;
+        #else
+            return cpu_isa::baseline;
+        #endif
+        }
+
+        /// The instruction set the kernels use, chosen once per process:
+        /// `detected_cpu_isa()`, unless the environment variable
+        /// `RANGES_CPU_ISA` names a lower one (`baseline`, `sse4.2`, `avx2` or
+        /// `avx512`), which lets each path be tested on one machine. Naming an
+        /// instruction set the processor lacks has no effect.
+        inline cpu_isa active_cpu_isa()
+        {
+            static cpu_isa const isa = []
+            {
+                cpu_isa const best = detected_cpu_isa();
+                char const *const env = std::getenv("RANGES_CPU_ISA");
+                if(!env)
+                    return best;
+                static char const *const names[] = {"baseline", "sse4.2", "avx2", "avx512"};
+                for(int i = 0; i < 4; ++i)
+                    if(std::strcmp(env, names[i]) == 0)
+                        return static_cast<cpu_isa>(i) < best ? static_cast<cpu_isa>(i) : best;
+                return best;
+            }();
+            return isa;
+        }
+        /// @}
+
+        /// \cond
+        namespace detail
+        {
+            // A set of bytes.
+            struct byte_set
+            {
+                std::uint64_t bits[4];
+
+                void insert(unsigned char c) noexcept
+                {
+                    bits[c / 64] |= std::uint64_t{1} << (c % 64);
+                }
+                bool contains(unsigned char c) const noexcept
+                {
+                    return (bits[c / 64] >> (c % 64)) & 1;
+                }
+            };
+
+        #if RANGES_CPU_DISPATCH
+        #pragma GCC push_options
+        #pragma GCC target("sse4.2")
+        #define RANGES_SIMD_NS simd_sse42
+        #define RANGES_SIMD_BYTES 16
+        #define RANGES_SIMD_ANY(m) !_mm_testz_si128((__m128i)(m), (__m128i)(m))
+        #define RANGES_SIMD_SHUFFLE_BYTES(t, i) _mm_shuffle_epi8((__m128i)(t), (__m128i)(i))
+        #include <range/v3/detail/simd_kernels.hpp>
+        #undef RANGES_SIMD_SHUFFLE_BYTES
+        #undef RANGES_SIMD_ANY
+        #undef RANGES_SIMD_BYTES
+        #undef RANGES_SIMD_NS
+        #pragma GCC pop_options
+
+        #pragma GCC push_options
+        #pragma GCC target("avx2")
+        #define RANGES_SIMD_NS simd_avx2
+        #define RANGES_SIMD_BYTES 32
+        #define RANGES_SIMD_ANY(m) !_mm256_testz_si256((__m256i)(m), (__m256i)(m))
+        #define RANGES_SIMD_SHUFFLE_BYTES(t, i) _mm256_shuffle_epi8((__m256i)(t), (__m256i)(i))
+        #include <range/v3/detail/simd_kernels.hpp>
+        #undef RANGES_SIMD_SHUFFLE_BYTES
+        #undef RANGES_SIMD_ANY
+        #undef RANGES_SIMD_BYTES
+        #undef RANGES_SIMD_NS
+        #pragma GCC pop_options
+
+        #pragma GCC push_options
+        #pragma GCC target("avx512f,avx512bw")
+        #define RANGES_SIMD_NS simd_avx512
+        #define RANGES_SIMD_BYTES 64
+        #define RANGES_SIMD_ANY(m) (_mm512_test_epi64_mask((__m512i)(m), (__m512i)(m)) != 0)
+        #define RANGES_SIMD_SHUFFLE_BYTES(t, i) _mm512_shuffle_epi8((__m512i)(t), (__m512i)(i))
+        #include <range/v3/detail/simd_kernels.hpp>
+        #undef RANGES_SIMD_SHUFFLE_BYTES
+        #undef RANGES_SIMD_ANY
+        #undef RANGES_SIMD_BYTES
+        #undef RANGES_SIMD_NS
+        #pragma GCC pop_options
+        #endif
+
+            // One instruction set's kernels for elements of type T.
+            template<typename T>
+            struct simd_kernel_table
+            {
+                T const *(*find)(T const *, T const *, T);
+                std::ptrdiff_t (*count)(T const *, T const *, T);
+                T const *(*mismatch)(T const *, T const *, T const *);
+                T const *(*min_element)(T const *, T const *);
+                T const *(*max_element)(T const *, T const *);
+            };
+
+            // The kernels for active_cpu_isa(), or null for the baseline.
+            template<typename T>
+            simd_kernel_table<T> const *simd_kernels()
+            {
+            #if RANGES_CPU_DISPATCH
+                static simd_kernel_table<T> const *const table = []
+                {
+                    static simd_kernel_table<T> const tables[] = {
+                        {&simd_sse42::find<T>, &simd_sse42::count<T>, &simd_sse42::mismatch<T>,
+                            &simd_sse42::min_element<T>, &simd_sse42::max_element<T>},
+                        {&simd_avx2::find<T>, &simd_avx2::count<T>, &simd_avx2::mismatch<T>,
+                            &simd_avx2::min_element<T>, &simd_avx2::max_element<T>},
+                        {&simd_avx512::find<T>, &simd_avx512::count<T>, &simd_avx512::mismatch<T>,
+                            &simd_avx512::min_element<T>, &simd_avx512::max_element<T>}};
+                    int const isa = static_cast<int>(active_cpu_isa());
+                    return isa == 0 ? nullptr : &tables[isa - 1];
+                }();
+                return table;
+            #else
+                return nullptr;
+            #endif
+            }
+
+            using find_byte_of_kernel = unsigned char const *(*)(unsigned char const *,
+                unsigned char const *, byte_set const &);
+
+            // The find_first_of kernel for active_cpu_isa(), or null for the
+            // baseline.
+            inline find_byte_of_kernel simd_find_byte_of_kernel()
+            {
+            #if RANGES_CPU_DISPATCH
+                static find_byte_of_kernel const kernel = []
+                {
+                    static find_byte_of_kernel const kernels[] = {
+                        &simd_sse42::find_byte_of, &simd_avx2::find_byte_of,
+                        &simd_avx512::find_byte_of};
+                    int const isa = static_cast<int>(active_cpu_isa());
+                    return isa == 0 ? nullptr : kernels[isa - 1];
+                }();
+                return kernel;
+            #else
+                return nullptr;
+            #endif
+            }
+
+            // The kernel for active_cpu_isa() out of one per instruction set,
+            // or null for the baseline.
+            template<typename K>
+            K simd_select(K sse42, K avx2, K avx512)
+            {
+                switch(active_cpu_isa())
+                {
+                case cpu_isa::sse42:
+                    return sse42;
+                case cpu_isa::avx2:
+                    return avx2;
+                case cpu_isa::avx512:
+                    return avx512;
+                default:
+                    return nullptr;
+                }
+            }
+
+            // Below this many elements the call through the table costs more
+            // than it saves.
+            constexpr std::ptrdiff_t simd_min_size = 32;
+
+            template<typename T>
+            using SimdElement = meta::strict_and<
+                std::is_integral<T>,
+                meta::not_<std::is_same<T, bool>>>;
+
+            // Whether [I, S) is a contiguous array of integers that a kernel can
+            // search for a V, after projection with P.
+            template<typename I, typename S, typename P, typename V = iterator_value_t<I>>
+            using SimdSearchable = meta::strict_and<
+                std::is_pointer<I>,
+                std::is_same<I, S>,
+                std::is_same<P, ident>,
+                SimdElement<iterator_value_t<I>>,
+                std::is_same<V, iterator_value_t<I>>>;
+
+            // The same for a range, whose iterators need not be pointers.
+            template<typename Rng, typename P, typename V = range_value_t<Rng>>
+            using SimdSearchableRange = meta::strict_and<
+                ContiguousRange<Rng>,
+                SizedRange<Rng>,
+                std::is_same<P, ident>,
+                SimdElement<range_value_t<Rng>>,
+                std::is_same<V, range_value_t<Rng>>>;
+
+            // Whether a kernel can compare the contiguous [I0, S0) with the
+            // elements from I1, or search it for the elements of a pattern
+            // with iterator I1, with C after projections P0 and P1.
+            template<typename I0, typename S0, typename I1, typename C, typename P0,
+                typename P1>
+            using SimdComparable = meta::strict_and<
+                std::is_same<C, equal_to>,
+                std::is_same<P1, ident>,
+                SimdSearchable<I0, S0, P0, iterator_value_t<I1>>>;
+
+            // The same for a range, and a second range.
+            template<typename Rng0, typename Rng1, typename C, typename P0, typename P1>
+            using SimdComparableRange = meta::strict_and<
+                std::is_same<C, equal_to>,
+                std::is_same<P1, ident>,
+                SimdSearchableRange<Rng0, P0, range_value_t<Rng1>>>;
+
+            // The element types of the replace, reverse, swap_ranges and
+            // transform kernels.
+            template<typename T, typename U = meta::_t<std::remove_cv<T>>>
+            using SimdArithmetic = meta::strict_and<
+                std::is_arithmetic<U>,
+                meta::not_<std::is_same<U, bool>>,
+                meta::not_<std::is_same<U, long double>>>;
+
+            // Whether Rng is a contiguous array of arithmetic values that the
+            // kernels can read without projection.
+            template<typename Rng, typename P = ident>
+            using SimdArithmeticRange = meta::strict_and<
+                ContiguousRange<Rng>,
+                SizedRange<Rng>,
+                std::is_same<P, ident>,
+                SimdArithmetic<meta::_t<std::remove_reference<range_reference_t<Rng>>>>>;
+
+            // Whether [I, S) is a contiguous array of arithmetic values that a
+            // kernel can replace T0s with T1s in, or otherwise permute.
+            template<typename I, typename S, typename P = ident,
+                typename T0 = iterator_value_t<I>, typename T1 = iterator_value_t<I>>
+            using SimdPermutable = meta::strict_and<
+                std::is_pointer<I>,
+                std::is_same<I, S>,
+                std::is_same<P, ident>,
+                SimdArithmetic<meta::_t<std::remove_pointer<I>>>,
+                std::is_same<T0, iterator_value_t<I>>,
+                std::is_same<T1, iterator_value_t<I>>>;
+
+            // The same for a range.
+            template<typename Rng, typename P = ident,
+                typename T0 = range_value_t<Rng>, typename T1 = range_value_t<Rng>>
+            using SimdPermutableRange = meta::strict_and<
+                SimdArithmeticRange<Rng, P>,
+                std::is_same<T0, range_value_t<Rng>>,
+                std::is_same<T1, range_value_t<Rng>>>;
+
+            // Whether a kernel can write f(*i), or f(*i, *j), for the
+            // contiguous [I, S) and J to the array O.
+            template<typename O, typename I, typename S, typename J = I>
+            using SimdTransformable = meta::strict_and<
+                std::is_pointer<I>,
+                std::is_same<I, S>,
+                std::is_pointer<J>,
+                std::is_pointer<O>,
+                SimdArithmetic<meta::_t<std::remove_pointer<I>>>,
+                SimdArithmetic<meta::_t<std::remove_pointer<J>>>,
+                SimdArithmetic<meta::_t<std::remove_pointer<O>>>>;
+
+            // The same for a range, written to an array or through an iterator
+            // of the range's own type, which is then contiguous too.
+            template<typename O, typename Rng, typename P = ident>
+            using SimdTransformableRange = meta::strict_and<
+                SimdArithmeticRange<Rng, P>,
+                meta::or_<std::is_pointer<O>, std::is_same<O, range_iterator_t<Rng>>>,
+                SimdArithmetic<meta::_t<std::remove_reference<iterator_reference_t<O>>>>>;
+
+            // Whether a kernel can copy the elements of the contiguous [I, S)
+            // that satisfy a predicate, after projection with P, to the array O.
+            template<typename I, typename S, typename O, typename P>
+            using SimdFilterable = meta::strict_and<
+                std::is_pointer<I>,
+                std::is_same<I, S>,
+                std::is_same<P, ident>,
+                SimdArithmetic<meta::_t<std::remove_pointer<I>>>,
+                std::is_same<O, meta::_t<std::remove_const<meta::_t<std::remove_pointer<I>>>> *>>;
+
+            // Whether C orders elements as the kernels' operator< does.
+            template<typename C>
+            using SimdLess = meta::or_<std::is_same<C, ordered_less>, std::is_same<C, less>>;
+
+            template<typename T>
+            T const *simd_find(T const *first, T const *last, T value)
+            {
+                auto const k = last - first >= simd_min_size ? simd_kernels<T>() : nullptr;
+                if(k)
+                    return k->find(first, last, value);
+                for(; first != last; ++first)
+                    if(*first == value)
+                        break;
+                return first;
+            }
+
+            inline unsigned char const *simd_find_byte_of(unsigned char const *first,
+                unsigned char const *last, byte_set const &set)
+            {
+                auto const k = last - first >= simd_min_size ? simd_find_byte_of_kernel() : nullptr;
+                if(k)
+                    return k(first, last, set);
+                for(; first != last; ++first)
+                    if(set.contains(*first))
+                        break;
+                return first;
+            }
+
+            template<typename T>
+            std::ptrdiff_t simd_count(T const *first, T const *last, T value)
+            {
+                auto const k = last - first >= simd_min_size ? simd_kernels<T>() : nullptr;
+                if(k)
+                    return k->count(first, last, value);
+                std::ptrdiff_t n = 0;
+                for(; first != last; ++first)
+                    if(*first == value)
+                        ++n;
+                return n;
+            }
+
+            // The first element of [first1, last1) that differs from the one at
+            // the same offset from first2.
+            template<typename T>
+            T const *simd_mismatch(T const *first1, T const *last1, T const *first2)
+            {
+                auto const k = last1 - first1 >= simd_min_size ? simd_kernels<T>() : nullptr;
+                if(k)
+                    return k->mismatch(first1, last1, first2);
+                for(; first1 != last1; ++first1, ++first2)
+                    if(!(*first1 == *first2))
+                        break;
+                return first1;
+            }
+
+            template<typename T>
+            T const *simd_min_element(T const *first, T const *last)
+            {
+                auto const k = last - first >= simd_min_size ? simd_kernels<T>() : nullptr;
+                if(k)
+                    return k->min_element(first, last);
+                if(first != last)
+                    for(auto p = first + 1; p != last; ++p)
+                        if(*p < *first)
+                            first = p;
+                return first;
+            }
+
+            template<typename T>
+            T const *simd_max_element(T const *first, T const *last)
+            {
+                auto const k = last - first >= simd_min_size ? simd_kernels<T>() : nullptr;
+                if(k)
+                    return k->max_element(first, last);
+                if(first != last)
+                    for(auto p = first + 1; p != last; ++p)
+                        if(*first < *p)
+                            first = p;
+                return first;
+            }
+
+            template<typename T>
+            void simd_replace(T *first, T *last, T old_value, T new_value)
+            {
+            #if RANGES_CPU_DISPATCH
+                static auto const k = detail::simd_select(&simd_sse42::replace<T>,
+                    &simd_avx2::replace<T>, &simd_avx512::replace<T>);
+                if(k && last - first >= simd_min_size)
+                    return k(first, last, old_value, new_value);
+            #endif
+                for(; first != last; ++first)
+                    if(*first == old_value)
+                        *first = new_value;
+            }
+
+            template<typename T, typename C>
+            void simd_replace_if(T *first, T *last, C &pred, T new_value)
+            {
+            #if RANGES_CPU_DISPATCH
+                static auto const k = detail::simd_select(&simd_sse42::replace_if<T, C>,
+                    &simd_avx2::replace_if<T, C>, &simd_avx512::replace_if<T, C>);
+                if(k && last - first >= simd_min_size)
+                    return k(first, last, pred, new_value);
+            #endif
+                for(; first != last; ++first)
+                    if(invoke(pred, *first))
+                        *first = new_value;
+            }
+
+            // Copies the elements of [first, last) that satisfy pred to out,
+            // which overlaps no input or starts at or before first. Returns
+            // the end of the output.
+            template<typename T, typename U, typename C>
+            U *simd_copy_if(T *first, T *last, U *out, C &pred)
+            {
+            #if RANGES_CPU_DISPATCH
+                static auto const k = detail::simd_select(&simd_sse42::copy_if<T, U, C>,
+                    &simd_avx2::copy_if<T, U, C>, &simd_avx512::copy_if<T, U, C>);
+                if(k && last - first >= simd_min_size)
+                    return k(first, last, out, pred);
+            #endif
+                for(; first != last; ++first)
+                    if(invoke(pred, *first))
+                        *out++ = *first;
+                return out;
+            }
+
+            template<typename T>
+            void simd_reverse(T *first, T *last)
+            {
+            #if RANGES_CPU_DISPATCH
+                static auto const k = detail::simd_select(&simd_sse42::reverse<T>,
+                    &simd_avx2::reverse<T>, &simd_avx512::reverse<T>);
+                if(k && last - first >= simd_min_size)
+                    return k(first, last);
+            #endif
+                for(; last - first > 1; ++first)
+                {
+                    T const t = *first;
+                    *first = *--last;
+                    *last = t;
+                }
+            }
+
+            template<typename T>
+            void simd_swap_ranges(T *first1, T *last1, T *first2)
+            {
+            #if RANGES_CPU_DISPATCH
+                static auto const k = detail::simd_select(&simd_sse42::swap_ranges<T>,
+                    &simd_avx2::swap_ranges<T>, &simd_avx512::swap_ranges<T>);
+                if(k && last1 - first1 >= simd_min_size)
+                    return k(first1, last1, first2);
+            #endif
+                for(; first1 != last1; ++first1, ++first2)
+                {
+                    T const t = *first1;
+                    *first1 = *first2;
+                    *first2 = t;
+                }
+            }
+
+            // Whether [p, p + n) and [q, q + m) share no bytes.
+            template<typename T, typename U>
+            bool disjoint(T *p, std::ptrdiff_t n, U *q, std::ptrdiff_t m)
+            {
+                auto const a = reinterpret_cast<std::uintptr_t>(p);
+                auto const b = reinterpret_cast<std::uintptr_t>(q);
+                return a + static_cast<std::uintptr_t>(n) * sizeof(T) <= b ||
+                    b + static_cast<std::uintptr_t>(m) * sizeof(U) <= a;
+            }
+
+            template<typename T, typename F>
+            bool simd_transform_in_place(T *first, T *last, T *out, F &fun)
+            {
+            #if RANGES_CPU_DISPATCH
+                static auto const k = detail::simd_select(&simd_sse42::transform_in_place<T, F>,
+                    &simd_avx2::transform_in_place<T, F>, &simd_avx512::transform_in_place<T, F>);
+                if(k && first == out)
+                {
+                    k(first, last, fun);
+                    return true;
+                }
+            #endif
+                return false;
+            }
+            template<typename T, typename U, typename F>
+            bool simd_transform_in_place(T *, T *, U *, F &)
+            {
+                return false;
+            }
+
+            // Writes fun(*i) for each i in [first, last) to out, which is first
+            // or overlaps no input. Returns the end of the output.
+            template<typename T, typename U, typename F>
+            U *simd_transform(T *first, T *last, U *out, F &fun)
+            {
+                auto const n = last - first;
+            #if RANGES_CPU_DISPATCH
+                if(n >= simd_min_size)
+                {
+                    if(detail::simd_transform_in_place(first, last, out, fun))
+                        return out + n;
+                    static auto const k = detail::simd_select(
+                        &simd_sse42::transform<T, U, F>, &simd_avx2::transform<T, U, F>,
+                        &simd_avx512::transform<T, U, F>);
+                    if(k && detail::disjoint(first, n, out, n))
+                    {
+                        k(first, last, out, fun);
+                        return out + n;
+                    }
+                }
+            #endif
+                for(; first != last; ++first, ++out)
+                    *out = invoke(fun, *first);
+                return out;
+            }
+
+            template<typename T0, typename T1, typename F>
+            bool simd_transform2_in_place(T0 *first0, T0 *last0, T1 *first1, T0 *out, F &fun)
+            {
+            #if RANGES_CPU_DISPATCH
+                static auto const k = detail::simd_select(
+                    &simd_sse42::transform2_in_place<T0, T1, F>,
+                    &simd_avx2::transform2_in_place<T0, T1, F>,
+                    &simd_avx512::transform2_in_place<T0, T1, F>);
+                if(k && first0 == out && detail::disjoint(first0, last0 - first0, first1, last0 - first0))
+                {
+                    k(first0, last0, first1, fun);
+                    return true;
+                }
+            #endif
+                return false;
+            }
+            template<typename T0, typename T1, typename U, typename F>
+            bool simd_transform2_in_place(T0 *, T0 *, T1 *, U *, F &)
+            {
+                return false;
+            }
+
+            // Writes fun(*i0, *i1) for each i0 in [first0, last0) and the
+            // corresponding i1 from first1 to out.
+            template<typename T0, typename T1, typename U, typename F>
+            U *simd_transform2(T0 *first0, T0 *last0, T1 *first1, U *out, F &fun)
+            {
+                auto const n = last0 - first0;
+            #if RANGES_CPU_DISPATCH
+                if(n >= simd_min_size)
+                {
+                    if(detail::simd_transform2_in_place(first0, last0, first1, out, fun))
+                        return out + n;
+                    static auto const k = detail::simd_select(
+                        &simd_sse42::transform2<T0, T1, U, F>,
+                        &simd_avx2::transform2<T0, T1, U, F>,
+                        &simd_avx512::transform2<T0, T1, U, F>);
+                    if(k && detail::disjoint(first0, n, out, n) &&
+                        detail::disjoint(first1, n, out, n))
+                    {
+                        k(first0, last0, first1, out, fun);
+                        return out + n;
+                    }
+                }
+            #endif
+                for(; first0 != last0; ++first0, ++first1, ++out)
+                    *out = invoke(fun, *first0, *first1);
+                return out;
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
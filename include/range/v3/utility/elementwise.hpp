@@ -0,0 +1,314 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_ELEMENTWISE_HPP
+#define RANGES_V3_UTILITY_ELEMENTWISE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// Whether `Fun` computes each result from its arguments alone: it has
+        /// no side effects, does not modify its arguments and does not care
+        /// how often or in what order it is called. `transform`, `transform2`
+        /// and `zip_with` views of random-access ranges of arithmetic values
+        /// whose functions are elementwise are copied into containers and
+        /// arrays with a flat indexed loop, which the compiler can vectorize,
+        /// rather than through their iterators. Specialize this for your own
+        /// function objects, or wrap lambdas with `elementwise`.
+        template<typename Fun>
+        struct is_elementwise
+          : meta::bool_<
+                std::is_same<Fun, ident>::value ||
+                std::is_same<Fun, plus>::value ||
+                std::is_same<Fun, minus>::value ||
+                std::is_same<Fun, multiplies>::value>
+        {};
+
+        template<typename T>
+        struct is_elementwise<std::plus<T>> : std::true_type {};
+        template<typename T>
+        struct is_elementwise<std::minus<T>> : std::true_type {};
+        template<typename T>
+        struct is_elementwise<std::multiplies<T>> : std::true_type {};
+        template<typename T>
+        struct is_elementwise<std::divides<T>> : std::true_type {};
+        template<typename T>
+        struct is_elementwise<std::negate<T>> : std::true_type {};
+
+        /// A function object marked as elementwise.
+        /// \sa `is_elementwise`
+        template<typename Fun>
+        struct elementwise_function
+        {
+        private:
+            Fun fun_;
+        public:
+            elementwise_function() = default;
+            constexpr explicit elementwise_function(Fun fun)
+              : fun_(std::move(fun))
+            {}
+            template<typename ...Args>
+            auto operator()(Args &&...args) const
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                invoke(fun_, static_cast<Args &&>(args)...)
+            )
+        };
+
+        template<typename Fun>
+        struct is_elementwise<elementwise_function<Fun>> : std::true_type {};
+
+        struct elementwise_fn
+        {
+            template<typename Fun>
+            constexpr elementwise_function<Fun> operator()(Fun fun) const
+            {
+                return elementwise_function<Fun>{std::move(fun)};
+            }
+        };
+
+        /// `elementwise(f)` asserts that `f` is elementwise.
+        /// \code
+        /// auto v = view::zip_with(elementwise([](double x, double y) { return x * y + 1; }),
+        ///     a, b) | to_vector;
+        /// \endcode
+        /// \sa `is_elementwise`
+        RANGES_INLINE_VARIABLE(elementwise_fn, elementwise)
+        /// @}
+
+        /// \cond
+        namespace detail
+        {
+            struct elementwise_access
+            {
+                template<typename Rng, typename Fun>
+                static auto fun(iter_transform_view<Rng, Fun> const &v)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    (v.fun_)
+                )
+                template<typename Rng1, typename Rng2, typename Fun>
+                static auto fun(iter_transform2_view<Rng1, Rng2, Fun> const &v)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    (v.fun_)
+                )
+                template<typename Rng1, typename Rng2, typename Fun>
+                static auto rngs(iter_transform2_view<Rng1, Rng2, Fun> const &v)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    std::tie(v.rng1_, v.rng2_)
+                )
+                template<typename Fun, typename ...Rngs>
+                static auto fun(iter_zip_with_view<Fun, Rngs...> const &v)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    (v.fun_)
+                )
+                template<typename Fun, typename ...Rngs>
+                static auto rngs(iter_zip_with_view<Fun, Rngs...> const &v)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    (v.rngs_)
+                )
+            };
+
+            struct elementwise_none
+              : std::false_type
+            {};
+
+            // A random-access range of arithmetic values, read by index
+            // through its iterator.
+            template<typename Rng>
+            struct elementwise_leaf
+              : std::true_type
+            {
+                struct eval
+                {
+                    range_iterator_t<Rng const> it;
+                    range_value_t<Rng const> operator[](std::ptrdiff_t i) const
+                    {
+                        return it[static_cast<range_difference_t<Rng const>>(i)];
+                    }
+                };
+                static eval make(Rng const &rng)
+                {
+                    return {ranges::begin(rng)};
+                }
+            };
+
+            template<typename Rng>
+            struct arithmetic_range_value
+              : std::is_arithmetic<range_value_t<Rng>>
+            {};
+
+            template<typename Rng>
+            using elementwise_leaf_or_none = meta::if_<
+                meta::and_<
+                    RandomAccessRange<Rng const>,
+                    SizedRange<Rng const>,
+                    arithmetic_range_value<Rng const>>,
+                elementwise_leaf<Rng>,
+                elementwise_none>;
+
+            // How to evaluate the range Rng by index, or elementwise_none. A
+            // view whose function is not elementwise is a leaf, read through
+            // its iterators.
+            template<typename Rng>
+            struct elementwise_expr
+              : elementwise_leaf_or_none<Rng>
+            {};
+
+            // The function of a transform, transform2 or zip_with view
+            // applied to its evaluated arguments. The view stores the
+            // function as an indirected<Fun>, which takes iterators, so it is
+            // passed the addresses of the arguments.
+            template<typename View, typename FunRef, typename ...Rngs>
+            struct elementwise_node
+              : std::true_type
+            {
+                struct eval
+                {
+                    FunRef fun;
+                    std::tuple<typename elementwise_expr<Rngs>::eval...> args;
+
+                    template<std::size_t ...Is>
+                    range_value_t<View> at(std::ptrdiff_t i, meta::index_sequence<Is...>) const
+                    {
+                        return this->apply(std::get<Is>(args)[i]...);
+                    }
+                    template<typename ...Ts>
+                    range_value_t<View> apply(Ts ...ts) const
+                    {
+                        return fun(&ts...);
+                    }
+                    range_value_t<View> operator[](std::ptrdiff_t i) const
+                    {
+                        return this->at(i, meta::make_index_sequence<sizeof...(Rngs)>{});
+                    }
+                };
+                template<typename Tuple, std::size_t ...Is>
+                static eval make_(View const &v, Tuple const &rngs, meta::index_sequence<Is...>)
+                {
+                    return {elementwise_access::fun(v),
+                        std::make_tuple(elementwise_expr<Rngs>::make(std::get<Is>(rngs))...)};
+                }
+                static eval make(View const &v)
+                {
+                    return elementwise_node::make_(v, elementwise_access::rngs(v),
+                        meta::make_index_sequence<sizeof...(Rngs)>{});
+                }
+            };
+
+            template<typename Rng, typename Fun>
+            struct elementwise_transform
+              : elementwise_node<transform_view<Rng, Fun>,
+                    semiregular_t<indirected<Fun>> const &, Rng>
+            {
+                using base_t = elementwise_node<transform_view<Rng, Fun>,
+                    semiregular_t<indirected<Fun>> const &, Rng>;
+                static typename base_t::eval make(transform_view<Rng, Fun> const &v)
+                {
+                    return {elementwise_access::fun(v),
+                        std::make_tuple(elementwise_expr<Rng>::make(v.base()))};
+                }
+            };
+
+            template<typename Fun, typename ...Rngs>
+            using ElementwiseNode = meta::and_<
+                is_elementwise<Fun>,
+                elementwise_expr<Rngs>...>;
+
+            template<typename Rng, typename Fun>
+            struct elementwise_expr<transform_view<Rng, Fun>>
+              : meta::if_<ElementwiseNode<Fun, Rng>,
+                    elementwise_transform<Rng, Fun>,
+                    elementwise_leaf_or_none<transform_view<Rng, Fun>>>
+            {};
+
+            template<typename Rng1, typename Rng2, typename Fun>
+            struct elementwise_expr<transform2_view<Rng1, Rng2, Fun>>
+              : meta::if_<ElementwiseNode<Fun, Rng1, Rng2>,
+                    elementwise_node<transform2_view<Rng1, Rng2, Fun>,
+                        semiregular_t<indirected<Fun>> const &, Rng1, Rng2>,
+                    elementwise_leaf_or_none<transform2_view<Rng1, Rng2, Fun>>>
+            {};
+
+            template<typename Fun, typename ...Rngs>
+            struct elementwise_expr<zip_with_view<Fun, Rngs...>>
+              : meta::if_<ElementwiseNode<Fun, Rngs...>,
+                    elementwise_node<zip_with_view<Fun, Rngs...>,
+                        semiregular_t<indirected<Fun>> const &, Rngs...>,
+                    elementwise_leaf_or_none<zip_with_view<Fun, Rngs...>>>
+            {};
+
+            template<typename Rng>
+            struct is_elementwise_node
+              : std::false_type
+            {};
+            template<typename Rng, typename Fun>
+            struct is_elementwise_node<transform_view<Rng, Fun>>
+              : is_elementwise<Fun>
+            {};
+            template<typename Rng1, typename Rng2, typename Fun>
+            struct is_elementwise_node<transform2_view<Rng1, Rng2, Fun>>
+              : is_elementwise<Fun>
+            {};
+            template<typename Fun, typename ...Rngs>
+            struct is_elementwise_node<zip_with_view<Fun, Rngs...>>
+              : is_elementwise<Fun>
+            {};
+
+            // A transform, transform2 or zip_with view with an elementwise
+            // function whose arguments can all be evaluated by index.
+            template<typename Rng, typename V = uncvref_t<Rng>>
+            using ElementwiseExpression = meta::and_<
+                is_elementwise_node<V>,
+                SizedRange<Rng>,
+                elementwise_expr<V>>;
+
+            // Writes the elements of an ElementwiseExpression to out with a flat
+            // indexed loop; returns the end of the output.
+            template<typename Rng, typename O>
+            O elementwise_copy(Rng &rng, O out)
+            {
+                using V = uncvref_t<Rng>;
+                auto const n = static_cast<std::ptrdiff_t>(ranges::size(rng));
+                auto const e = elementwise_expr<V>::make(rng);
+                for(std::ptrdiff_t i = 0; i < n; ++i)
+                    out[i] = e[i];
+                return out + n;
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -0,0 +1,103 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_EXECUTION_HPP
+#define RANGES_V3_UTILITY_EXECUTION_HPP
+
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// Execution policy tag. Algorithms that accept it as their first
+        /// argument may split their input across threads; the caller must not
+        /// rely on the order in which elements are visited.
+        struct par_t {};
+
+        /// \sa `par_t`
+        RANGES_INLINE_VARIABLE(par_t, par)
+        /// @}
+
+        /// \cond
+        namespace detail
+        {
+            // The smallest number of elements worth handing to a thread.
+            constexpr std::ptrdiff_t par_min_chunk = 1 << 14;
+
+            // The number of chunks [0, n) is split into by parallel_chunks.
+            inline std::ptrdiff_t parallel_chunk_count(std::ptrdiff_t n)
+            {
+                std::ptrdiff_t threads = static_cast<std::ptrdiff_t>(
+                    std::thread::hardware_concurrency());
+                if(threads < 1)
+                    threads = 1;
+                std::ptrdiff_t const most = n / par_min_chunk;
+                return most < 1 ? 1 : (most < threads ? most : threads);
+            }
+
+            // Splits [0, n) into parallel_chunk_count(n) contiguous pieces and
+            // calls fn(chunk, first, last) for each, one per thread. The last
+            // chunk runs on the calling thread. If any call throws, the first
+            // exception (by chunk) is rethrown once all threads have joined. If
+            // a thread cannot be started, the ones that were are joined before
+            // the error propagates.
+            template<typename Fn>
+            void parallel_chunks(std::ptrdiff_t n, Fn fn)
+            {
+                std::ptrdiff_t const chunks = detail::parallel_chunk_count(n);
+                std::vector<std::exception_ptr> errors(static_cast<std::size_t>(chunks));
+                auto run = [&](std::ptrdiff_t chunk)
+                {
+                    try
+                    {
+                        fn(chunk, n * chunk / chunks, n * (chunk + 1) / chunks);
+                    }
+                    catch(...)
+                    {
+                        errors[static_cast<std::size_t>(chunk)] = std::current_exception();
+                    }
+                };
+                std::vector<std::thread> threads;
+                try
+                {
+                    threads.reserve(static_cast<std::size_t>(chunks - 1));
+                    for(std::ptrdiff_t chunk = 0; chunk < chunks - 1; ++chunk)
+                        threads.emplace_back(run, chunk);
+                }
+                catch(...)
+                {
+                    for(auto &t : threads)
+                        t.join();
+                    throw;
+                }
+                run(chunks - 1);
+                for(auto &t : threads)
+                    t.join();
+                for(auto &e : errors)
+                    if(e)
+                        std::rethrow_exception(e);
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -578,6 +578,187 @@ namespace ranges
         /// \sa `inserter_fn`
         RANGES_INLINE_VARIABLE(inserter_fn, inserter)
 
+        /// \cond
+        namespace detail
+        {
+            // Algorithms that know how many elements they will write through a
+            // back_insert_iterator or an insert_iterator make room for them in
+            // the container first, and copy whole forward ranges with a single
+            // range insert.
+            template<typename O>
+            struct insert_output
+              : std::false_type
+            {};
+            template<typename Cont>
+            struct insert_output<back_insert_iterator<Cont>>
+              : std::true_type
+            {};
+            template<typename Cont>
+            struct insert_output<insert_iterator<Cont>>
+              : std::true_type
+            {};
+
+            template<typename Cont>
+            auto reserve_more_(Cont &cont, std::size_t n, int) ->
+                decltype(cont.reserve(n), (void) cont.capacity())
+            {
+                // Never grow by less than the container would have, so that
+                // many short writes through the same iterator stay amortized
+                // constant time.
+                std::size_t const size = static_cast<std::size_t>(cont.size()) + n;
+                std::size_t const cap = static_cast<std::size_t>(cont.capacity());
+                if(size > cap)
+                    cont.reserve(size < 2 * cap ? 2 * cap : size);
+            }
+            template<typename Cont>
+            void reserve_more_(Cont &, std::size_t, long)
+            {}
+
+            template<typename Cont>
+            void reserve_output_n(back_insert_iterator<Cont> &out, std::size_t n)
+            {
+                detail::reserve_more_(*range_access::pos(out).cont_, n, 42);
+            }
+            template<typename Cont,
+                CONCEPT_REQUIRES_(RandomAccessIterator<typename Cont::iterator>())>
+            void reserve_output_n(insert_iterator<Cont> &out, std::size_t n)
+            {
+                // Growing the container invalidates the insert position.
+                auto &cur = range_access::pos(out);
+                auto const where = cur.where_ - cur.cont_->begin();
+                detail::reserve_more_(*cur.cont_, n, 42);
+                cur.where_ = cur.cont_->begin() + where;
+            }
+            template<typename Cont,
+                CONCEPT_REQUIRES_(!RandomAccessIterator<typename Cont::iterator>())>
+            void reserve_output_n(insert_iterator<Cont> &, std::size_t)
+            {}
+
+            // Makes room for n more elements behind out.
+            template<typename O, typename N,
+                CONCEPT_REQUIRES_(insert_output<O>() && Integral<N>())>
+            void reserve_output(O &out, N n)
+            {
+                if(n > 0)
+                    detail::reserve_output_n(out, static_cast<std::size_t>(n));
+            }
+            template<typename O, typename N,
+                CONCEPT_REQUIRES_(!insert_output<O>() && Integral<N>())>
+            void reserve_output(O &, N)
+            {}
+
+            // Makes room for the elements of [begin, end) behind out if their
+            // number is known.
+            template<typename O, typename I, typename S,
+                CONCEPT_REQUIRES_(insert_output<O>() && SizedSentinel<S, I>())>
+            void reserve_output(O &out, I const &begin, S const &end)
+            {
+                detail::reserve_output(out, end - begin);
+            }
+            template<typename O, typename I, typename S,
+                CONCEPT_REQUIRES_(!(insert_output<O>() && SizedSentinel<S, I>()))>
+            void reserve_output(O &, I const &, S const &)
+            {}
+
+            template<typename Cont, typename I, typename = void>
+            struct range_insertable_
+              : std::false_type
+            {};
+            template<typename Cont, typename I>
+            struct range_insertable_<Cont, I, meta::void_<
+                decltype(std::declval<Cont &>().insert(std::declval<typename Cont::iterator>(),
+                    std::declval<I>(), std::declval<I>())),
+                typename std::iterator_traits<I>::iterator_category>>
+              : meta::bool_<
+                    std::is_base_of<std::forward_iterator_tag,
+                        typename std::iterator_traits<I>::iterator_category>::value &&
+                    std::is_constructible<typename Cont::value_type,
+                        iterator_reference_t<I>>::value &&
+                    std::is_assignable<typename Cont::value_type &,
+                        iterator_reference_t<I>>::value>
+            {};
+
+            template<typename O, typename I>
+            struct bulk_insertable_
+              : std::false_type
+            {};
+            template<typename Cont, typename I>
+            struct bulk_insertable_<back_insert_iterator<Cont>, I>
+              : range_insertable_<Cont, I>
+            {};
+            template<typename Cont, typename I>
+            struct bulk_insertable_<insert_iterator<Cont>, I>
+              : range_insertable_<Cont, I>
+            {};
+
+            // [begin, end) can be handed to the container behind out in one
+            // range insert.
+            template<typename O, typename I, typename S>
+            using BulkInsertable = meta::strict_and<
+                Same<I, S>,
+                ForwardIterator<I>,
+                bulk_insertable_<O, I>>;
+
+            template<typename Cont, typename = void>
+            struct back_insert_growable_
+              : std::false_type
+            {};
+            template<typename Cont>
+            struct back_insert_growable_<Cont, meta::void_<
+                decltype(std::declval<Cont &>().resize(std::declval<typename Cont::size_type>()))>>
+              : meta::bool_<
+                    std::is_trivial<typename Cont::value_type>::value &&
+                    RandomAccessIterator<typename Cont::iterator>()>
+            {};
+
+            template<typename O>
+            struct back_insert_growable
+              : std::false_type
+            {};
+            // The container behind out holds trivial values and can be grown
+            // first and then written in place.
+            template<typename Cont>
+            struct back_insert_growable<back_insert_iterator<Cont>>
+              : back_insert_growable_<Cont>
+            {};
+
+            // Appends n value-initialized elements to the container behind out
+            // and returns an iterator to the first of them.
+            template<typename Cont>
+            typename Cont::iterator grow_back(back_insert_iterator<Cont> &out, std::size_t n)
+            {
+                Cont &cont = *range_access::pos(out).cont_;
+                auto const size = cont.size();
+                detail::reserve_more_(cont, n, 42);
+                cont.resize(size + n);
+                return cont.begin() + static_cast<iterator_difference_t<typename Cont::iterator>>(size);
+            }
+
+            // Drops the elements from end on, after writing in place failed.
+            template<typename Cont>
+            void shrink_back(back_insert_iterator<Cont> &out, typename Cont::iterator end)
+            {
+                Cont &cont = *range_access::pos(out).cont_;
+                cont.erase(end, cont.end());
+            }
+
+            template<typename Cont, typename I>
+            void bulk_insert(back_insert_iterator<Cont> &out, I begin, I end)
+            {
+                Cont &cont = *range_access::pos(out).cont_;
+                cont.insert(cont.end(), std::move(begin), std::move(end));
+            }
+            template<typename Cont, typename I>
+            void bulk_insert(insert_iterator<Cont> &out, I begin, I end)
+            {
+                auto &cur = range_access::pos(out);
+                auto const n = std::distance(begin, end);
+                cur.where_ = std::next(cur.cont_->insert(cur.where_, std::move(begin),
+                    std::move(end)), n);
+            }
+        }
+        /// \endcond
+
         /// \cond
         namespace detail {
             template<typename T = void, typename Char = char, typename Traits = std::char_traits<Char>>
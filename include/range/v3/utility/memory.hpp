@@ -21,8 +21,19 @@
 #ifndef RANGES_V3_UTILITY_MEMORY_HPP
 #define RANGES_V3_UTILITY_MEMORY_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
 #include <memory>
 #include <type_traits>
+#include <utility>
+#if defined(__unix__) || defined(__APPLE__)
+#include <stdlib.h>
+#endif
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/counted_iterator.hpp>
@@ -93,13 +104,62 @@ namespace ranges
                 }
             };
 
+            // The size of a transparent huge page. Blocks at least this large
+            // are aligned to it, and the kernel is asked to back them with
+            // huge pages.
+            constexpr std::size_t huge_page_size = std::size_t(1) << 21;
+
+            // Allocates bytes with at least the given alignment, or returns
+            // null. Memory from allocate_pages is freed with deallocate_pages.
+            inline void *allocate_pages(std::size_t bytes, std::size_t align) noexcept
+            {
+                if(bytes == 0)
+                    bytes = 1;
+            #if defined(__unix__) || defined(__APPLE__)
+                bool const huge = bytes >= huge_page_size;
+                if(huge && align < huge_page_size)
+                    align = huge_page_size;
+                if(align < sizeof(void *))
+                    align = sizeof(void *);
+                void *p = nullptr;
+                if(::posix_memalign(&p, align, bytes) != 0)
+                    return nullptr;
+            #if defined(__linux__) && defined(MADV_HUGEPAGE)
+                if(huge)
+                    ::madvise(p, bytes & ~(huge_page_size - 1), MADV_HUGEPAGE);
+            #endif
+                return p;
+            #else
+                return align <= alignof(std::max_align_t) ? std::malloc(bytes) : nullptr;
+            #endif
+            }
+
+            inline void deallocate_pages(void *p) noexcept
+            {
+                std::free(p);
+            }
+
+            // Like std::get_temporary_buffer, but large buffers are backed by
+            // huge pages. Release the buffer with return_temporary_buffer.
+            template<typename T>
+            std::pair<T *, std::ptrdiff_t> get_temporary_buffer(std::ptrdiff_t n) noexcept
+            {
+                std::ptrdiff_t const most =
+                    (std::numeric_limits<std::ptrdiff_t>::max)() / std::ptrdiff_t(sizeof(T));
+                if(n > most)
+                    n = most;
+                for(; n > 0; n /= 2)
+                    if(void *p = detail::allocate_pages(std::size_t(n) * sizeof(T), alignof(T)))
+                        return {static_cast<T *>(p), n};
+                return {nullptr, 0};
+            }
+
             struct return_temporary_buffer
             {
                 template<typename T>
                 void operator()(T *p) const
                 {
-                    if(p)
-                        std::return_temporary_buffer(p);
+                    detail::deallocate_pages(p);
                 }
             };
         }
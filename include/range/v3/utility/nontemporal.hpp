@@ -0,0 +1,176 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_NONTEMPORAL_HPP
+#define RANGES_V3_UTILITY_NONTEMPORAL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/static_const.hpp>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__GLIBC__)
+#include <unistd.h>
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// Store mode tag. Algorithms that accept it as their last argument
+        /// write a large destination with streaming stores, which bypass the
+        /// cache, so that filling it does not evict other data. The
+        /// destination must be a pointer to a trivially copyable type.
+        /// Destinations smaller than the threshold are written as usual; by
+        /// default the threshold is half the size of the last-level cache.
+        struct nontemporal_t
+        {
+        private:
+            std::size_t min_bytes_;
+        public:
+            constexpr explicit nontemporal_t(std::size_t min_bytes = std::size_t(-1))
+              : min_bytes_(min_bytes)
+            {}
+            /// The smallest destination, in bytes, written with streaming
+            /// stores.
+            std::size_t threshold() const;
+        };
+
+        /// \sa `nontemporal_t`
+        RANGES_INLINE_VARIABLE(nontemporal_t, nontemporal)
+        /// @}
+
+        /// \cond
+        namespace detail
+        {
+            inline std::size_t nontemporal_auto_threshold()
+            {
+                static std::size_t const threshold = []
+                {
+                    long llc = 0;
+                #if defined(__GLIBC__) && defined(_SC_LEVEL3_CACHE_SIZE)
+                    llc = ::sysconf(_SC_LEVEL3_CACHE_SIZE);
+                    if(llc <= 0)
+                        llc = ::sysconf(_SC_LEVEL2_CACHE_SIZE);
+                #endif
+                    return llc > 0 ? static_cast<std::size_t>(llc) / 2 : std::size_t(1) << 22;
+                }();
+                return threshold;
+            }
+
+            // Whether O is a pointer to objects that can be written a byte at
+            // a time.
+            template<typename O>
+            using NontemporalOutput = meta::strict_and<
+                std::is_pointer<O>,
+                meta::not_<std::is_const<meta::_t<std::remove_pointer<O>>>>,
+                std::is_trivially_copyable<meta::_t<std::remove_pointer<O>>>>;
+
+            // Copies n bytes with streaming stores. The destination is aligned
+            // with ordinary stores first. The stores are weakly ordered until
+            // nontemporal_fence() is called.
+            inline void nontemporal_copy_bytes(void *dst, void const *src, std::size_t n)
+            {
+                auto d = static_cast<unsigned char *>(dst);
+                auto s = static_cast<unsigned char const *>(src);
+            #if defined(__SSE2__)
+                std::size_t head = (16u - reinterpret_cast<std::uintptr_t>(d) % 16u) % 16u;
+                if(head > n)
+                    head = n;
+                std::memcpy(d, s, head);
+                d += head, s += head, n -= head;
+                for(; n >= 64; d += 64, s += 64, n -= 64)
+                {
+                    __m128i const a = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s));
+                    __m128i const b = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s + 16));
+                    __m128i const c = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s + 32));
+                    __m128i const e = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s + 48));
+                    _mm_stream_si128(reinterpret_cast<__m128i *>(d), a);
+                    _mm_stream_si128(reinterpret_cast<__m128i *>(d + 16), b);
+                    _mm_stream_si128(reinterpret_cast<__m128i *>(d + 32), c);
+                    _mm_stream_si128(reinterpret_cast<__m128i *>(d + 48), e);
+                }
+                for(; n >= 16; d += 16, s += 16, n -= 16)
+                    _mm_stream_si128(reinterpret_cast<__m128i *>(d),
+                        _mm_loadu_si128(reinterpret_cast<__m128i const *>(s)));
+            #endif
+                std::memcpy(d, s, n);
+            }
+
+            // Orders the streaming stores before any later stores.
+            inline void nontemporal_fence()
+            {
+            #if defined(__SSE2__)
+                _mm_sfence();
+            #endif
+            }
+
+            // Collects elements of type T in a small buffer that is flushed to
+            // the destination with streaming stores.
+            template<typename T>
+            struct nontemporal_writer
+            {
+                static constexpr std::size_t capacity =
+                    sizeof(T) >= 4096 ? 1 : 4096 / sizeof(T);
+            private:
+                alignas(16) unsigned char buf_[capacity * sizeof(T)];
+                std::size_t size_;
+                T *out_;
+            public:
+                explicit nontemporal_writer(T *out)
+                  : size_(0), out_(out)
+                {}
+                template<typename U>
+                void push(U &&u)
+                {
+                    T const t = static_cast<U &&>(u);
+                    std::memcpy(buf_ + size_ * sizeof(T), &t, sizeof(T));
+                    if(++size_ == capacity)
+                        this->flush();
+                }
+                void flush()
+                {
+                    nontemporal_copy_bytes(out_, buf_, size_ * sizeof(T));
+                    out_ += size_;
+                    size_ = 0;
+                }
+                // Flushes the buffer, fences, and returns the end of the
+                // output.
+                T *finish()
+                {
+                    this->flush();
+                    nontemporal_fence();
+                    return out_;
+                }
+            };
+
+            template<typename T>
+            constexpr std::size_t nontemporal_writer<T>::capacity;
+        }
+        /// \endcond
+
+        inline std::size_t nontemporal_t::threshold() const
+        {
+            return min_bytes_ == std::size_t(-1) ? detail::nontemporal_auto_threshold() : min_bytes_;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,105 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_PAGE_ALLOCATOR_HPP
+#define RANGES_V3_UTILITY_PAGE_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/memory.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// An allocator for large arrays. Blocks of 2 MiB or more are aligned
+        /// to 2 MiB and backed by transparent huge pages where the system
+        /// supports them, which saves TLB misses when walking the array.
+        ///
+        /// With `FirstTouch`, a large block is touched, before it is
+        /// returned, by the same threads and in the same chunks as a `par`
+        /// algorithm over an array of that many elements. Since memory is
+        /// placed on the NUMA node of the thread that first touches it, each
+        /// such worker then finds its chunk in local memory. Because the
+        /// choice is part of the type, it carries over to containers that
+        /// default-construct their allocator, as `to_` does:
+        /// \code
+        /// auto v = rng | to_<std::vector<float, page_allocator<float, true>>>();
+        /// \endcode
+        template<typename T, bool FirstTouch = false>
+        struct page_allocator
+        {
+            using value_type = T;
+            template<typename U>
+            struct rebind
+            {
+                using other = page_allocator<U, FirstTouch>;
+            };
+
+            page_allocator() = default;
+            template<typename U>
+            constexpr page_allocator(page_allocator<U, FirstTouch> const &) noexcept
+            {}
+            T *allocate(std::size_t n)
+            {
+                if(n > (std::numeric_limits<std::size_t>::max)() / sizeof(T))
+                    throw std::bad_alloc{};
+                std::size_t const bytes = n * sizeof(T);
+                void *const p = detail::allocate_pages(bytes, alignof(T));
+                if(!p)
+                    throw std::bad_alloc{};
+                if(FirstTouch && bytes >= detail::huge_page_size)
+                    page_allocator::first_touch(static_cast<unsigned char *>(p), n);
+                return static_cast<T *>(p);
+            }
+            void deallocate(T *p, std::size_t) noexcept
+            {
+                detail::deallocate_pages(p);
+            }
+            template<typename U>
+            friend constexpr bool operator==(page_allocator const &,
+                page_allocator<U, FirstTouch> const &) noexcept
+            {
+                return true;
+            }
+            template<typename U>
+            friend constexpr bool operator!=(page_allocator const &,
+                page_allocator<U, FirstTouch> const &) noexcept
+            {
+                return false;
+            }
+        private:
+            // Writes one byte in each page of each worker's chunk.
+            static void first_touch(unsigned char *p, std::size_t n)
+            {
+                constexpr std::size_t page = 4096;
+                detail::parallel_chunks(static_cast<std::ptrdiff_t>(n),
+                    [p](std::ptrdiff_t, std::ptrdiff_t lo, std::ptrdiff_t hi)
+                    {
+                        auto first = p + static_cast<std::size_t>(lo) * sizeof(T);
+                        auto const last = p + static_cast<std::size_t>(hi) * sizeof(T);
+                        for(; first < last; first += page)
+                            *first = 0;
+                    });
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
@@ -0,0 +1,159 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_PHILOX_HPP
+#define RANGES_V3_UTILITY_PHILOX_HPP
+
+#include <array>
+#include <cstdint>
+#include <range/v3/range_fwd.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// The Philox4x32-10 counter-based random number engine of Salmon et
+        /// al., "Parallel Random Numbers: As Easy as 1, 2, 3" (SC 2011).
+        ///
+        /// Each block of four outputs is a keyed bijection of a 128-bit
+        /// counter, so there is no state to warm up: constructing an engine is
+        /// as cheap as copying one, which suits short-lived threads, and
+        /// `discard` jumps ahead in constant time. The 64-bit seed is the key.
+        /// The counter holds a 64-bit stream number and a 64-bit block number
+        /// within the stream. Different streams of one seed are independent
+        /// sequences, which is how work is split between threads
+        /// deterministically.
+        class philox4x32
+        {
+        public:
+            using result_type = std::uint32_t;
+
+        private:
+            std::array<std::uint32_t, 2> key_;
+            // Words 0 and 1 count blocks, words 2 and 3 hold the stream.
+            std::array<std::uint32_t, 4> ctr_;
+            std::array<std::uint32_t, 4> out_;
+            unsigned next_;
+
+            static void mulhilo(std::uint32_t a, std::uint32_t b, std::uint32_t &hi,
+                std::uint32_t &lo) noexcept
+            {
+                std::uint64_t const p = std::uint64_t{a} * b;
+                hi = static_cast<std::uint32_t>(p >> 32);
+                lo = static_cast<std::uint32_t>(p);
+            }
+            std::uint64_t block_number() const noexcept
+            {
+                return ctr_[0] | std::uint64_t{ctr_[1]} << 32;
+            }
+            void set_block_number(std::uint64_t n) noexcept
+            {
+                ctr_[0] = static_cast<std::uint32_t>(n);
+                ctr_[1] = static_cast<std::uint32_t>(n >> 32);
+            }
+            // Computes the block at the counter and moves to the next one.
+            void refill() noexcept
+            {
+                out_ = philox4x32::block(ctr_, key_);
+                set_block_number(block_number() + 1);
+                next_ = 0;
+            }
+
+        public:
+            static constexpr result_type min() noexcept
+            {
+                return 0;
+            }
+            static constexpr result_type max() noexcept
+            {
+                return 0xffffffffu;
+            }
+
+            /// The Philox4x32-10 bijection of `ctr` under `key`.
+            static std::array<std::uint32_t, 4> block(std::array<std::uint32_t, 4> ctr,
+                std::array<std::uint32_t, 2> key) noexcept
+            {
+                for(int round = 0; round < 10; ++round)
+                {
+                    if(round != 0)
+                    {
+                        key[0] += 0x9E3779B9u;
+                        key[1] += 0xBB67AE85u;
+                    }
+                    std::uint32_t hi0, lo0, hi1, lo1;
+                    philox4x32::mulhilo(0xD2511F53u, ctr[0], hi0, lo0);
+                    philox4x32::mulhilo(0xCD9E8D57u, ctr[2], hi1, lo1);
+                    ctr = {{hi1 ^ ctr[1] ^ key[0], lo1, hi0 ^ ctr[3] ^ key[1], lo0}};
+                }
+                return ctr;
+            }
+
+            philox4x32() noexcept
+              : philox4x32(0)
+            {}
+            explicit philox4x32(std::uint64_t seed, std::uint64_t stream = 0) noexcept
+              : key_{}, ctr_{}, out_{}, next_{}
+            {
+                this->seed(seed, stream);
+            }
+
+            /// Restarts the engine at the beginning of `stream` for `seed`.
+            void seed(std::uint64_t seed = 0, std::uint64_t stream = 0) noexcept
+            {
+                key_ = {{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)}};
+                ctr_ = {{0, 0, static_cast<std::uint32_t>(stream),
+                    static_cast<std::uint32_t>(stream >> 32)}};
+                next_ = 4;
+            }
+
+            result_type operator()() noexcept
+            {
+                if(next_ == 4)
+                    refill();
+                return out_[next_++];
+            }
+
+            /// Skips `z` outputs in constant time.
+            void discard(unsigned long long z) noexcept
+            {
+                if(z <= 4 - next_)
+                {
+                    next_ += static_cast<unsigned>(z);
+                    return;
+                }
+                z -= 4 - next_;
+                set_block_number(block_number() + z / 4);
+                next_ = 4;
+                if(z % 4 != 0)
+                {
+                    refill();
+                    next_ = static_cast<unsigned>(z % 4);
+                }
+            }
+
+            friend bool operator==(philox4x32 const &x, philox4x32 const &y) noexcept
+            {
+                return x.key_ == y.key_ && x.ctr_ == y.ctr_ && x.next_ == y.next_;
+            }
+            friend bool operator!=(philox4x32 const &x, philox4x32 const &y) noexcept
+            {
+                return !(x == y);
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
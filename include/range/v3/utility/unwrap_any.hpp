@@ -0,0 +1,65 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_UNWRAP_ANY_HPP
+#define RANGES_V3_UTILITY_UNWRAP_ANY_HPP
+
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        struct unwrap_any_fn
+        {
+        private:
+            template<typename Rng, typename Fun>
+            static auto impl(Rng &rng, Fun &fun, std::true_type)
+                -> decltype(fun(rng))
+            {
+                auto const s = rng.contiguous();
+                if(s.data() != nullptr)
+                    return fun(s);
+                return fun(rng);
+            }
+            template<typename Rng, typename Fun>
+            static auto impl(Rng &rng, Fun &fun, std::false_type)
+                -> decltype(fun(rng))
+            {
+                return fun(rng);
+            }
+        public:
+            /// Calls `fun` once with the range to operate on: a `span` of the
+            /// elements of an `any_view` whose erased range is contiguous, so the
+            /// whole algorithm runs without virtual calls, and `rng` itself
+            /// otherwise. `fun` must accept both.
+            template<typename Rng, typename Fun,
+                CONCEPT_REQUIRES_(Range<Rng>())>
+            auto operator()(Rng &rng, Fun fun) const
+                -> decltype(fun(rng))
+            {
+                return unwrap_any_fn::impl(rng, fun,
+                    detail::is_any_view<meta::_t<std::remove_const<Rng>>>{});
+            }
+        };
+
+        /// \sa `unwrap_any_fn`
+        /// \ingroup group-views
+        RANGES_INLINE_VARIABLE(unwrap_any_fn, unwrap_any)
+    }
+}
+
+#endif
@@ -0,0 +1,173 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_WORK_BUDGET_HPP
+#define RANGES_V3_UTILITY_WORK_BUDGET_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <range/v3/range_fwd.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// The outcome of a call to `resume` on a resumable algorithm.
+        enum class resumable_status
+        {
+            suspended,  ///< The budget ran out; call `resume` again to continue.
+            done,       ///< The algorithm has finished.
+            cancelled   ///< The algorithm was cancelled and will not continue.
+        };
+
+        /// How much work a resumable algorithm may do before it suspends: a
+        /// number of elements, a span of time, or both. Time is checked every
+        /// few dozen elements, so a time budget may overrun slightly.
+        struct work_budget
+        {
+        private:
+            std::ptrdiff_t elements_ = (std::numeric_limits<std::ptrdiff_t>::max)();
+            std::chrono::steady_clock::duration time_ =
+                (std::chrono::steady_clock::duration::max)();
+        public:
+            work_budget() = default;
+            work_budget(std::ptrdiff_t elements, std::chrono::steady_clock::duration time)
+              : elements_(elements), time_(time)
+            {}
+            static work_budget unlimited()
+            {
+                return {};
+            }
+            static work_budget elements(std::ptrdiff_t n)
+            {
+                RANGES_EXPECT(0 <= n);
+                work_budget b;
+                b.elements_ = n;
+                return b;
+            }
+            template<typename Rep, typename Period>
+            static work_budget time(std::chrono::duration<Rep, Period> d)
+            {
+                work_budget b;
+                b.time_ = std::chrono::duration_cast<std::chrono::steady_clock::duration>(d);
+                return b;
+            }
+            std::ptrdiff_t element_limit() const
+            {
+                return elements_;
+            }
+            std::chrono::steady_clock::duration time_limit() const
+            {
+                return time_;
+            }
+        };
+
+        /// A flag shared by all copies of a token. A default-constructed token
+        /// can never be cancelled; use `make_cancellation_token` to get one that
+        /// can. Cancellation may be requested from any thread.
+        struct cancellation_token
+        {
+        private:
+            std::shared_ptr<std::atomic<bool>> flag_;
+            explicit cancellation_token(std::shared_ptr<std::atomic<bool>> flag)
+              : flag_(std::move(flag))
+            {}
+            friend cancellation_token make_cancellation_token();
+        public:
+            cancellation_token() = default;
+            void cancel() const
+            {
+                if(flag_)
+                    flag_->store(true, std::memory_order_relaxed);
+            }
+            bool cancelled() const
+            {
+                return flag_ && flag_->load(std::memory_order_relaxed);
+            }
+        };
+
+        inline cancellation_token make_cancellation_token()
+        {
+            return cancellation_token{std::make_shared<std::atomic<bool>>(false)};
+        }
+        /// @}
+
+        /// \cond
+        namespace detail
+        {
+            // Tracks one call's budget. spend(n) is called before each unit of
+            // n elements' work and returns false when the work should stop. A
+            // unit may overdraw the element budget, so that units larger than
+            // the budget still make progress.
+            struct budget_meter
+            {
+            private:
+                // How many elements pass between checks of the clock and the
+                // cancellation token.
+                static constexpr std::ptrdiff_t check_interval = 64;
+                std::ptrdiff_t left_;
+                std::ptrdiff_t until_check_;
+                bool timed_;
+                bool cancelled_;
+                std::chrono::steady_clock::time_point deadline_;
+                cancellation_token const &token_;
+
+                bool check()
+                {
+                    until_check_ = check_interval;
+                    if(token_.cancelled())
+                    {
+                        cancelled_ = true;
+                        return false;
+                    }
+                    if(timed_ && std::chrono::steady_clock::now() >= deadline_)
+                    {
+                        left_ = 0;
+                        return false;
+                    }
+                    return true;
+                }
+            public:
+                budget_meter(work_budget const &budget, cancellation_token const &token)
+                  : left_(budget.element_limit()), until_check_(0)
+                  , timed_(budget.time_limit() != (std::chrono::steady_clock::duration::max)())
+                  , cancelled_(false), deadline_(), token_(token)
+                {
+                    if(timed_)
+                        deadline_ = std::chrono::steady_clock::now() + budget.time_limit();
+                }
+                bool spend(std::ptrdiff_t n = 1)
+                {
+                    if(left_ <= 0 || cancelled_)
+                        return false;
+                    if((until_check_ -= n) <= 0 && !this->check())
+                        return false;
+                    left_ -= n;
+                    return true;
+                }
+                resumable_status stopped() const
+                {
+                    return cancelled_ ? resumable_status::cancelled : resumable_status::suspended;
+                }
+            };
+        }
+        /// \endcond
+    }
+}
+
+#endif
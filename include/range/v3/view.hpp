@@ -34,6 +34,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/drop_while.hpp>
 #include <range/v3/view/empty.hpp>
 #include <range/v3/view/filter.hpp>
+#include <range/v3/view/find_all.hpp>
 #include <range/v3/view/for_each.hpp>
 #include <range/v3/view/generate.hpp>
 #include <range/v3/view/generate_n.hpp>
@@ -42,6 +43,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/intersperse.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/join.hpp>
+#include <range/v3/view/lines_reverse.hpp>
 #include <range/v3/view/map.hpp>
 #include <range/v3/view/move.hpp>
 #include <range/v3/view/partial_sum.hpp>
@@ -51,6 +53,8 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/replace.hpp>
 #include <range/v3/view/replace_if.hpp>
 #include <range/v3/view/reverse.hpp>
+#include <range/v3/view/rle_decode.hpp>
+#include <range/v3/view/rle_encode.hpp>
 #include <range/v3/view/sample.hpp>
 #include <range/v3/view/set_algorithm.hpp>
 #include <range/v3/view/single.hpp>
@@ -62,6 +66,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/take.hpp>
 #include <range/v3/view/take_exactly.hpp>
 #include <range/v3/view/take_while.hpp>
+#include <range/v3/view/tile2d.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/tokenize.hpp>
 #include <range/v3/view/unbounded.hpp>
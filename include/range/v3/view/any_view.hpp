@@ -22,22 +22,17 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/distance.hpp>
+#include <range/v3/span.hpp>
 #include <range/v3/view_facade.hpp>
 #include <range/v3/view/all.hpp>
 #include <range/v3/utility/polymorphic_cast.hpp>
+#include <range/v3/utility/unwrap_any.hpp>
 
 namespace ranges
 {
     inline namespace v3
     {
-        enum class category
-        {
-            input,
-            forward,
-            bidirectional,
-            random_access
-        };
-
         /// \cond
         namespace detail
         {
@@ -300,27 +295,62 @@ namespace ranges
                 }
             };
 
+            template<typename Ref>
+            using any_element_t = meta::_t<std::remove_reference<Ref>>;
+
+            // Whether the elements of Rng can be handed out as a span of
+            // any_element_t<Ref>. Contiguity is a property of the range passed
+            // to any_view, which may be lost once it is wrapped by view::all.
+            template<typename Rng, typename Ref>
+            using AnyContiguous = meta::strict_and<
+                std::is_lvalue_reference<Ref>,
+                ContiguousRange<Rng>,
+                SizedRange<Rng>,
+                Same<uncvref_t<range_reference_t<Rng>>, uncvref_t<Ref>>,
+                std::is_convertible<meta::_t<std::add_pointer<range_reference_t<Rng>>>,
+                    any_element_t<Ref> *>>;
+
             template<typename Ref, category Cat>
             struct any_view_interface
             {
                 virtual ~any_view_interface() = default;
                 virtual any_cursor<Ref, Cat> begin_cursor() = 0;
                 virtual any_sentinel end_cursor() = 0;
+                virtual span<any_element_t<Ref>> contiguous() = 0;
                 virtual any_view_interface *clone() const = 0;
             };
 
-            template<typename Rng, typename Ref, category Cat>
+            template<typename Rng, typename Ref, category Cat, bool Contiguous>
             struct any_view_impl
               : any_view_interface<Ref, Cat>
             {
             private:
                 CONCEPT_ASSERT(ConvertibleTo<range_reference_t<Rng>, Ref>());
                 Rng rng_;
+                span<any_element_t<Ref>> contiguous_(std::true_type)
+                {
+                    auto const n = static_cast<std::ptrdiff_t>(distance(rng_));
+                    if(n == 0)
+                        return {};
+                    return {std::addressof(*ranges::begin(rng_)), n};
+                }
+                span<any_element_t<Ref>> contiguous_(std::false_type)
+                {
+                    return {};
+                }
             public:
                 any_view_impl() = default;
                 any_view_impl(Rng rng)
                   : rng_(std::move(rng))
                 {}
+                Rng &base()
+                {
+                    return rng_;
+                }
+                Rng const &base() const
+                {
+                    return rng_;
+                }
                 any_cursor<Ref, Cat> begin_cursor() override
                 {
                     return {rng_, begin_tag{}};
@@ -329,6 +359,10 @@ namespace ranges
                 {
                     return {rng_, end_tag{}};
                 }
+                span<any_element_t<Ref>> contiguous() override
+                {
+                    return this->contiguous_(meta::bool_<Contiguous>{});
+                }
                 any_view_interface<Ref, Cat> *clone() const override
                 {
                     return new any_view_impl{rng_};
@@ -344,12 +378,15 @@ namespace ranges
 
         /// \brief A type-erased view
         /// \ingroup group-views
-        template<typename Ref, category Cat = category::input>
+        template<typename Ref, category Cat>
         struct any_view
           : view_facade<any_view<Ref, Cat>, unknown>
         {
         private:
             friend range_access;
+            template<typename Rng>
+            using impl_t = detail::any_view_impl<view::all_t<Rng>, Ref, Cat,
+                detail::AnyContiguous<Rng, Ref>::value>;
             std::unique_ptr<detail::any_view_interface<Ref, Cat>> ptr_;
             detail::any_cursor<Ref, Cat> begin_cursor()
             {
@@ -361,8 +398,7 @@ namespace ranges
             }
             template<typename Rng>
             any_view(Rng && rng, std::true_type)
-              : ptr_{new detail::any_view_impl<view::all_t<Rng>, Ref, Cat>{
-                    view::all(std::forward<Rng>(rng))}}
+              : ptr_{new impl_t<Rng>{view::all(std::forward<Rng>(rng))}}
             {}
             template<typename Rng>
             any_view(Rng &&, std::false_type)
@@ -393,6 +429,30 @@ namespace ranges
                 ptr_.reset(that.ptr_ ? that.ptr_->clone() : nullptr);
                 return *this;
             }
+            /// If the erased range is contiguous, a span of its elements;
+            /// otherwise, an empty span with a null data pointer. One virtual
+            /// call lets an algorithm pick a raw-pointer loop for the whole range,
+            /// as `count` and `count_if` do.
+            span<detail::any_element_t<Ref>> contiguous()
+            {
+                return ptr_ ? ptr_->contiguous() : span<detail::any_element_t<Ref>>{};
+            }
+            /// If this any_view was constructed from a range of type `Rng` (an
+            /// lvalue `Rng &`, or an rvalue `Rng` view), a pointer to the view of
+            /// it that is stored; otherwise, null.
+            template<typename Rng>
+            view::all_t<Rng &> *target()
+            {
+                auto const p = dynamic_cast<impl_t<Rng &> *>(ptr_.get());
+                return p ? &p->base() : nullptr;
+            }
+            /// \overload
+            template<typename Rng>
+            view::all_t<Rng &> const *target() const
+            {
+                auto const p = dynamic_cast<impl_t<Rng &> const *>(ptr_.get());
+                return p ? &p->base() : nullptr;
+            }
         };
 
         template<typename Ref>
@@ -0,0 +1,649 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_FILE_BLOCKS_HPP
+#define RANGES_V3_VIEW_FILE_BLOCKS_HPP
+
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#error "view::file_blocks requires POSIX pread"
+#endif
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/span.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/memory.hpp>
+#include <range/v3/utility/static_const.hpp>
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define RANGES_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Reads n bytes at offset off, or fewer at the end of the file.
+            // Returns the number of bytes read or -errno.
+            inline long pread_full(int fd, char *buf, std::size_t n, off_t off)
+            {
+                std::size_t done = 0;
+                while(done < n)
+                {
+                    auto const r = ::pread(fd, buf + done, n - done,
+                        off + static_cast<off_t>(done));
+                    if(r < 0 && errno == EINTR)
+                        continue;
+                    if(r < 0)
+                        return -errno;
+                    if(r == 0)
+                        break;
+                    done += static_cast<std::size_t>(r);
+                }
+                return static_cast<long>(done);
+            }
+
+            // Reads queued on a helper thread, which serves them in order.
+            struct pread_queue
+            {
+            private:
+                struct request
+                {
+                    int slot;
+                    int fd;
+                    char *buf;
+                    std::size_t n;
+                    off_t off;
+                };
+                std::mutex mtx_;
+                std::condition_variable cv_;
+                std::deque<request> queue_;
+                std::vector<long> result_;
+                std::vector<char> ready_;
+                bool stop_ = false;
+                std::thread worker_;
+
+                void run()
+                {
+                    for(;;)
+                    {
+                        request r;
+                        {
+                            std::unique_lock<std::mutex> lock{mtx_};
+                            cv_.wait(lock, [this]{ return stop_ || !queue_.empty(); });
+                            if(queue_.empty())
+                                return;
+                            r = queue_.front();
+                            queue_.pop_front();
+                        }
+                        long const n = detail::pread_full(r.fd, r.buf, r.n, r.off);
+                        {
+                            std::lock_guard<std::mutex> lock{mtx_};
+                            result_[static_cast<std::size_t>(r.slot)] = n;
+                            ready_[static_cast<std::size_t>(r.slot)] = true;
+                        }
+                        cv_.notify_all();
+                    }
+                }
+            public:
+                explicit pread_queue(int slots)
+                  : result_(static_cast<std::size_t>(slots))
+                  , ready_(static_cast<std::size_t>(slots))
+                  , worker_([this]{ this->run(); })
+                {}
+                ~pread_queue()
+                {
+                    {
+                        std::lock_guard<std::mutex> lock{mtx_};
+                        stop_ = true;
+                    }
+                    cv_.notify_all();
+                    worker_.join();
+                }
+                void submit(int slot, int fd, char *buf, std::size_t n, off_t off)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock{mtx_};
+                        ready_[static_cast<std::size_t>(slot)] = false;
+                        queue_.push_back({slot, fd, buf, n, off});
+                    }
+                    cv_.notify_all();
+                }
+                long wait(int slot)
+                {
+                    std::unique_lock<std::mutex> lock{mtx_};
+                    cv_.wait(lock, [&]{ return ready_[static_cast<std::size_t>(slot)] != 0; });
+                    return result_[static_cast<std::size_t>(slot)];
+                }
+            };
+
+        #ifdef RANGES_IO_URING
+            // Reads submitted to an io_uring, driven directly through the
+            // system calls so that no library is needed.
+            struct io_uring_queue
+            {
+            private:
+                int ring_ = -1;
+                void *rings_ = MAP_FAILED;
+                std::size_t rings_bytes_ = 0;
+                void *sqes_ = MAP_FAILED;
+                std::size_t sqes_bytes_ = 0;
+                unsigned *sq_tail_ = nullptr;
+                unsigned *sq_mask_ = nullptr;
+                unsigned *sq_array_ = nullptr;
+                unsigned *cq_head_ = nullptr;
+                unsigned *cq_tail_ = nullptr;
+                unsigned *cq_mask_ = nullptr;
+                io_uring_cqe *cqes_ = nullptr;
+                std::vector<long> result_;
+                std::vector<char> ready_;
+
+                int enter(unsigned submit, unsigned wait)
+                {
+                    for(;;)
+                    {
+                        long const r = ::syscall(__NR_io_uring_enter, ring_, submit, wait,
+                            wait ? IORING_ENTER_GETEVENTS : 0u, nullptr, 0);
+                        if(r >= 0 || errno != EINTR)
+                            return r < 0 ? -errno : 0;
+                    }
+                }
+                template<typename T>
+                T *at(std::uint32_t offset) const
+                {
+                    return reinterpret_cast<T *>(static_cast<char *>(rings_) + offset);
+                }
+            public:
+                io_uring_queue() = default;
+                io_uring_queue(io_uring_queue const &) = delete;
+                io_uring_queue &operator=(io_uring_queue const &) = delete;
+                ~io_uring_queue()
+                {
+                    if(sqes_ != MAP_FAILED)
+                        ::munmap(sqes_, sqes_bytes_);
+                    if(rings_ != MAP_FAILED)
+                        ::munmap(rings_, rings_bytes_);
+                    if(ring_ != -1)
+                        ::close(ring_);
+                }
+                // Sets up a ring for `slots` reads in flight. Returns false if
+                // the kernel lacks io_uring, or IORING_OP_READ (before 5.6), or
+                // does not allow it.
+                bool open(int slots)
+                {
+                    io_uring_params p;
+                    std::memset(&p, 0, sizeof(p));
+                    long const fd = ::syscall(__NR_io_uring_setup,
+                        static_cast<unsigned>(slots), &p);
+                    if(fd < 0)
+                        return false;
+                    ring_ = static_cast<int>(fd);
+                    // IORING_FEAT_FAST_POLL came with 5.7, so IORING_OP_READ
+                    // is there too.
+                    if(!(p.features & IORING_FEAT_SINGLE_MMAP) ||
+                       !(p.features & IORING_FEAT_FAST_POLL))
+                        return false;
+                    std::size_t const sq_bytes = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+                    std::size_t const cq_bytes = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+                    rings_bytes_ = sq_bytes < cq_bytes ? cq_bytes : sq_bytes;
+                    rings_ = ::mmap(nullptr, rings_bytes_, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, ring_, IORING_OFF_SQ_RING);
+                    if(rings_ == MAP_FAILED)
+                        return false;
+                    sqes_bytes_ = p.sq_entries * sizeof(io_uring_sqe);
+                    sqes_ = ::mmap(nullptr, sqes_bytes_, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, ring_, IORING_OFF_SQES);
+                    if(sqes_ == MAP_FAILED)
+                        return false;
+                    sq_tail_ = at<unsigned>(p.sq_off.tail);
+                    sq_mask_ = at<unsigned>(p.sq_off.ring_mask);
+                    sq_array_ = at<unsigned>(p.sq_off.array);
+                    cq_head_ = at<unsigned>(p.cq_off.head);
+                    cq_tail_ = at<unsigned>(p.cq_off.tail);
+                    cq_mask_ = at<unsigned>(p.cq_off.ring_mask);
+                    cqes_ = at<io_uring_cqe>(p.cq_off.cqes);
+                    result_.assign(static_cast<std::size_t>(slots), 0);
+                    ready_.assign(static_cast<std::size_t>(slots), true);
+                    return true;
+                }
+                void submit(int slot, int fd, char *buf, std::size_t n, off_t off)
+                {
+                    unsigned const tail = *sq_tail_;
+                    unsigned const i = tail & *sq_mask_;
+                    auto &sqe = static_cast<io_uring_sqe *>(sqes_)[i];
+                    std::memset(&sqe, 0, sizeof(sqe));
+                    sqe.opcode = IORING_OP_READ;
+                    sqe.fd = fd;
+                    sqe.addr = reinterpret_cast<std::uintptr_t>(buf);
+                    sqe.len = static_cast<std::uint32_t>(n);
+                    sqe.off = static_cast<std::uint64_t>(off);
+                    sqe.user_data = static_cast<std::uint64_t>(slot);
+                    sq_array_[i] = i;
+                    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+                    ready_[static_cast<std::size_t>(slot)] = false;
+                    if(int const err = this->enter(1, 0))
+                        throw std::system_error{-err, std::generic_category(), "io_uring_enter"};
+                }
+                long wait(int slot)
+                {
+                    while(!ready_[static_cast<std::size_t>(slot)])
+                    {
+                        unsigned head = *cq_head_;
+                        unsigned const tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+                        if(head == tail)
+                        {
+                            if(int const err = this->enter(0, 1))
+                                throw std::system_error{-err, std::generic_category(),
+                                    "io_uring_enter"};
+                            continue;
+                        }
+                        for(; head != tail; ++head)
+                        {
+                            auto const &cqe = cqes_[head & *cq_mask_];
+                            result_[cqe.user_data] = cqe.res;
+                            ready_[cqe.user_data] = true;
+                        }
+                        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+                    }
+                    return result_[static_cast<std::size_t>(slot)];
+                }
+            };
+        #endif
+
+            // Reads a file in blocks, keeping up to `depth` reads in flight
+            // ahead of the block being consumed. The current block stays valid
+            // until next().
+            struct file_block_reader
+            {
+            private:
+                int fd_;
+                std::size_t block_;
+                int depth_;
+                char *buf_;
+                std::vector<off_t> offset_;
+                std::vector<char> pending_;
+                off_t next_offset_ = 0;
+                int head_ = 0;
+                span<char const> current_;
+                bool eof_ = false;
+                bool done_ = false;
+            #ifdef RANGES_IO_URING
+                io_uring_queue uring_;
+                bool use_uring_ = false;
+            #endif
+                std::unique_ptr<pread_queue> pread_;
+
+                char *slot_buffer(int slot) const
+                {
+                    return buf_ + static_cast<std::size_t>(slot) * block_;
+                }
+                void submit(int slot)
+                {
+                    auto const s = static_cast<std::size_t>(slot);
+                    offset_[s] = next_offset_;
+                    next_offset_ += static_cast<off_t>(block_);
+                #ifdef RANGES_IO_URING
+                    if(use_uring_)
+                        uring_.submit(slot, fd_, this->slot_buffer(slot), block_, offset_[s]);
+                    else
+                #endif
+                        pread_->submit(slot, fd_, this->slot_buffer(slot), block_, offset_[s]);
+                    pending_[s] = true;
+                }
+                long wait(int slot)
+                {
+                    pending_[static_cast<std::size_t>(slot)] = false;
+                #ifdef RANGES_IO_URING
+                    if(use_uring_)
+                        return uring_.wait(slot);
+                #endif
+                    return pread_->wait(slot);
+                }
+                // Waits for the reads still in flight, so that the buffers can
+                // be freed.
+                void drain() noexcept
+                {
+                    for(int slot = 0; slot < depth_; ++slot)
+                        if(pending_[static_cast<std::size_t>(slot)])
+                        {
+                            try
+                            {
+                                this->wait(slot);
+                            }
+                            catch(...)
+                            {
+                                pending_[static_cast<std::size_t>(slot)] = true;
+                            }
+                        }
+                }
+                void release() noexcept
+                {
+                    this->drain();
+                    pread_.reset();
+                    detail::deallocate_pages(buf_);
+                    ::close(fd_);
+                }
+                // Makes the block in slot head_ current, or sets done_.
+                void fetch()
+                {
+                    if(!pending_[static_cast<std::size_t>(head_)])
+                    {
+                        done_ = true;
+                        return;
+                    }
+                    long n = this->wait(head_);
+                    auto const buf = this->slot_buffer(head_);
+                    // io_uring may stop short before the end of the file.
+                    if(0 < n && static_cast<std::size_t>(n) < block_)
+                    {
+                        long const rest = detail::pread_full(fd_, buf + n,
+                            block_ - static_cast<std::size_t>(n),
+                            offset_[static_cast<std::size_t>(head_)] + n);
+                        n = rest < 0 ? rest : n + rest;
+                    }
+                    if(n < 0)
+                        throw std::system_error{static_cast<int>(-n), std::generic_category(),
+                            "file_blocks: read"};
+                    if(static_cast<std::size_t>(n) < block_)
+                        eof_ = true;
+                    if(n == 0)
+                        done_ = true;
+                    else
+                        current_ = {buf, static_cast<std::ptrdiff_t>(n)};
+                }
+            public:
+                file_block_reader(std::string const &path, std::size_t block, int depth)
+                  : fd_(::open(path.c_str(), O_RDONLY | O_CLOEXEC))
+                  , block_(block), depth_(depth), buf_(nullptr)
+                  , offset_(static_cast<std::size_t>(depth))
+                  , pending_(static_cast<std::size_t>(depth))
+                {
+                    RANGES_EXPECT(0 < block && 0 < depth);
+                    if(fd_ < 0)
+                        throw std::system_error{errno, std::generic_category(),
+                            "file_blocks: " + path};
+                #ifdef POSIX_FADV_SEQUENTIAL
+                    ::posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+                #endif
+                    buf_ = static_cast<char *>(detail::allocate_pages(
+                        block_ * static_cast<std::size_t>(depth_), 4096));
+                    try
+                    {
+                        if(!buf_)
+                            throw std::bad_alloc{};
+                    #ifdef RANGES_IO_URING
+                        use_uring_ = !std::getenv("RANGES_NO_IO_URING") && uring_.open(depth_);
+                        if(!use_uring_)
+                    #endif
+                            pread_.reset(new pread_queue{depth_});
+                        for(int slot = 0; slot < depth_; ++slot)
+                            this->submit(slot);
+                        this->fetch(); // prime the pump
+                    }
+                    catch(...)
+                    {
+                        this->release();
+                        throw;
+                    }
+                }
+                file_block_reader(file_block_reader const &) = delete;
+                file_block_reader &operator=(file_block_reader const &) = delete;
+                ~file_block_reader()
+                {
+                    this->release();
+                }
+                span<char const> current() const noexcept
+                {
+                    return current_;
+                }
+                bool done() const noexcept
+                {
+                    return done_;
+                }
+                // Reuses the current block's buffer for the next read, then
+                // waits for the following block.
+                void next()
+                {
+                    RANGES_EXPECT(!done_);
+                    if(!eof_)
+                        this->submit(head_);
+                    head_ = head_ + 1 == depth_ ? 0 : head_ + 1;
+                    this->fetch();
+                }
+                bool uses_io_uring() const noexcept
+                {
+                #ifdef RANGES_IO_URING
+                    return use_uring_;
+                #else
+                    return false;
+                #endif
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// The contents of a file as a single-pass range of contiguous blocks
+        /// (`span<char const>`), each `block_size` bytes but the last. Reads
+        /// are issued `queue_depth` blocks ahead of the block being consumed,
+        /// through io_uring where the kernel supports it and on a helper thread
+        /// with `pread` elsewhere (or if the environment variable
+        /// `RANGES_NO_IO_URING` is set), so that the disk is busy while the
+        /// program works. A block is valid until the iterator is incremented.
+        /// Copies of the view share the reader. Errors are thrown as
+        /// `std::system_error`.
+        struct file_blocks_view
+          : view_facade<file_blocks_view, unknown>
+        {
+        private:
+            friend range_access;
+            std::shared_ptr<detail::file_block_reader> rd_;
+            struct cursor
+            {
+            private:
+                detail::file_block_reader *rd_;
+            public:
+                cursor() = default;
+                explicit cursor(detail::file_block_reader &rd)
+                  : rd_(&rd)
+                {}
+                span<char const> read() const noexcept
+                {
+                    return rd_->current();
+                }
+                void next()
+                {
+                    rd_->next();
+                }
+                bool equal(default_sentinel) const noexcept
+                {
+                    return rd_->done();
+                }
+            };
+            cursor begin_cursor()
+            {
+                return cursor{*rd_};
+            }
+        public:
+            file_blocks_view() = default;
+            explicit file_blocks_view(std::string const &path, std::size_t block_size = 1u << 16,
+                int queue_depth = 4)
+              : rd_(std::make_shared<detail::file_block_reader>(path, block_size, queue_depth))
+            {}
+            bool uses_io_uring() const noexcept
+            {
+                return rd_->uses_io_uring();
+            }
+        };
+
+        /// The lines of a file, read as `file_blocks_view` reads it, as a
+        /// single-pass range of `span<char const>` without their newlines. A
+        /// line is a view of the block it lies in, or of a buffer if it spans
+        /// two blocks, and is valid until the iterator is incremented. As with
+        /// `getlines`, a newline at the very end of the file does not start
+        /// an empty last line.
+        struct file_lines_view
+          : view_facade<file_lines_view, unknown>
+        {
+        private:
+            friend range_access;
+            struct state
+            {
+                detail::file_block_reader rd;
+                // The unread part of rd.current().
+                span<char const> rest;
+                std::string carry;
+                span<char const> line;
+                bool done;
+
+                state(std::string const &path, std::size_t block, int depth)
+                  : rd(path, block, depth), rest(rd.done() ? span<char const>{} : rd.current())
+                  , carry{}, line{}, done(false)
+                {
+                    this->next(); // prime the pump
+                }
+                void next()
+                {
+                    bool carrying = false;
+                    for(;;)
+                    {
+                        if(!rest.empty())
+                        {
+                            auto const b = rest.data();
+                            auto const n = static_cast<std::size_t>(rest.size());
+                            if(auto const nl = static_cast<char const *>(std::memchr(b, '\n', n)))
+                            {
+                                rest = {nl + 1, b + n};
+                                if(!carrying)
+                                {
+                                    line = {b, nl};
+                                    return;
+                                }
+                                carry.append(b, nl);
+                                line = {carry.data(), static_cast<std::ptrdiff_t>(carry.size())};
+                                return;
+                            }
+                            if(!carrying)
+                                carry.clear();
+                            carry.append(b, n);
+                            carrying = true;
+                            rest = {};
+                        }
+                        if(rd.done())
+                            break;
+                        rd.next();
+                        if(!rd.done())
+                            rest = rd.current();
+                    }
+                    if(carrying)
+                        line = {carry.data(), static_cast<std::ptrdiff_t>(carry.size())};
+                    else
+                        done = true;
+                }
+            };
+            std::shared_ptr<state> st_;
+            struct cursor
+            {
+            private:
+                state *st_;
+            public:
+                cursor() = default;
+                explicit cursor(state &st)
+                  : st_(&st)
+                {}
+                span<char const> read() const noexcept
+                {
+                    return st_->line;
+                }
+                void next()
+                {
+                    st_->next();
+                }
+                bool equal(default_sentinel) const noexcept
+                {
+                    return st_->done;
+                }
+            };
+            cursor begin_cursor()
+            {
+                return cursor{*st_};
+            }
+        public:
+            file_lines_view() = default;
+            explicit file_lines_view(std::string const &path, std::size_t block_size = 1u << 16,
+                int queue_depth = 4)
+              : st_(std::make_shared<state>(path, block_size, queue_depth))
+            {}
+            bool uses_io_uring() const noexcept
+            {
+                return st_->rd.uses_io_uring();
+            }
+        };
+
+        namespace view
+        {
+            struct file_blocks_fn
+            {
+                file_blocks_view operator()(std::string const &path,
+                    std::size_t block_size = 1u << 16, int queue_depth = 4) const
+                {
+                    return file_blocks_view{path, block_size, queue_depth};
+                }
+            };
+
+            struct file_lines_fn
+            {
+                file_lines_view operator()(std::string const &path,
+                    std::size_t block_size = 1u << 16, int queue_depth = 4) const
+                {
+                    return file_lines_view{path, block_size, queue_depth};
+                }
+            };
+
+            /// \relates file_blocks_fn
+            /// \ingroup group-views
+            RANGES_INLINE_VARIABLE(file_blocks_fn, file_blocks)
+
+            /// \relates file_lines_fn
+            /// \ingroup group-views
+            RANGES_INLINE_VARIABLE(file_lines_fn, file_lines)
+        }
+        /// @}
+    }
+}
+
+#endif
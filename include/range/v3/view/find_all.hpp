@@ -0,0 +1,382 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_FIND_ALL_HPP
+#define RANGES_V3_VIEW_FIND_ALL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <type_traits>
+#include <vector>
+#include <meta/meta.hpp>
+#include <range/v3/detail/satisfy_boost_range.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // An Aho-Corasick automaton over symbols of type T. Byte-sized
+            // integral symbols get a dense table holding every transition, so
+            // each text symbol costs one lookup. Other symbols keep only the
+            // trie edges, sorted, in one flat array, and follow failure links
+            // at match time.
+            template<typename T>
+            struct aho_corasick
+            {
+            private:
+                using state_t = std::uint32_t;
+                using dense_t = meta::bool_<sizeof(T) == 1 && std::is_integral<T>::value>;
+                static constexpr std::size_t alphabet = 256;
+
+                std::vector<state_t> fail_;
+                // The patterns that end in state s are
+                // out_ids_[out_off_[s]] ... out_ids_[out_off_[s + 1]].
+                std::vector<std::size_t> out_off_;
+                std::vector<std::size_t> out_ids_;
+                std::vector<std::ptrdiff_t> lengths_;
+                // Dense: table_[s * alphabet + c] is the next state.
+                std::vector<state_t> table_;
+                // Sparse: the trie edges out of s are
+                // [edge_off_[s], edge_off_[s + 1]), sorted by symbol.
+                std::vector<std::size_t> edge_off_;
+                std::vector<T> edge_sym_;
+                std::vector<state_t> edge_to_;
+
+                static std::size_t index(T c)
+                {
+                    return static_cast<unsigned char>(c);
+                }
+                state_t child(state_t s, T const &c) const
+                {
+                    auto const first = edge_sym_.begin() + static_cast<std::ptrdiff_t>(edge_off_[s]);
+                    auto const last = edge_sym_.begin() + static_cast<std::ptrdiff_t>(edge_off_[s + 1]);
+                    auto const it = std::lower_bound(first, last, c);
+                    return it != last && !(c < *it) ?
+                        edge_to_[static_cast<std::size_t>(it - edge_sym_.begin())] : 0;
+                }
+                state_t next(state_t s, T const &c, std::true_type) const
+                {
+                    return table_[s * alphabet + index(c)];
+                }
+                state_t next(state_t s, T const &c, std::false_type) const
+                {
+                    for(;; s = fail_[s])
+                    {
+                        if(state_t const t = this->child(s, c))
+                            return t;
+                        if(s == 0)
+                            return 0;
+                    }
+                }
+                template<typename Trie>
+                void build_edges(Trie const &trie)
+                {
+                    edge_off_.reserve(trie.size() + 1);
+                    edge_off_.push_back(0);
+                    for(auto const &edges : trie)
+                    {
+                        for(auto const &e : edges)
+                        {
+                            edge_sym_.push_back(e.first);
+                            edge_to_.push_back(e.second);
+                        }
+                        edge_off_.push_back(edge_sym_.size());
+                    }
+                }
+                // Replaces the edges with the full transition table, filled in
+                // breadth-first order so that each failure target's row is
+                // complete before it is copied.
+                template<typename Trie>
+                void build_table(Trie const &trie, std::vector<state_t> const &order,
+                    std::true_type)
+                {
+                    table_.assign(trie.size() * alphabet, 0);
+                    for(state_t s : order)
+                    {
+                        if(s != 0)
+                            std::copy_n(table_.begin() + static_cast<std::ptrdiff_t>(fail_[s] * alphabet),
+                                alphabet, table_.begin() + static_cast<std::ptrdiff_t>(s * alphabet));
+                        for(auto const &e : trie[s])
+                            table_[s * alphabet + index(e.first)] = e.second;
+                    }
+                    std::vector<std::size_t>().swap(edge_off_);
+                    std::vector<T>().swap(edge_sym_);
+                    std::vector<state_t>().swap(edge_to_);
+                }
+                template<typename Trie>
+                void build_table(Trie const &, std::vector<state_t> const &, std::false_type)
+                {}
+            public:
+                template<typename Pats>
+                explicit aho_corasick(Pats &&pats)
+                {
+                    // Build the trie, with edges sorted by symbol.
+                    std::vector<std::vector<std::pair<T, state_t>>> trie(1);
+                    std::vector<std::vector<std::size_t>> outs(1);
+                    for(auto &&pat : pats)
+                    {
+                        state_t s = 0;
+                        std::ptrdiff_t len = 0;
+                        for(auto &&elem : pat)
+                        {
+                            T const c = elem;
+                            auto &edges = trie[s];
+                            auto it = std::lower_bound(edges.begin(), edges.end(), c,
+                                [](std::pair<T, state_t> const &e, T const &x) { return e.first < x; });
+                            if(it != edges.end() && !(c < it->first))
+                                s = it->second;
+                            else
+                            {
+                                s = static_cast<state_t>(trie.size());
+                                edges.insert(it, {c, s});
+                                trie.emplace_back();
+                                outs.emplace_back();
+                            }
+                            ++len;
+                        }
+                        // Empty patterns never match.
+                        if(len != 0)
+                            outs[s].push_back(lengths_.size());
+                        lengths_.push_back(len);
+                    }
+                    this->build_edges(trie);
+
+                    // Compute the failure links breadth first, so that a
+                    // state's failure target, being shallower, is done first.
+                    fail_.assign(trie.size(), 0);
+                    std::vector<state_t> order;
+                    order.reserve(trie.size());
+                    order.push_back(0);
+                    for(std::size_t i = 0; i != order.size(); ++i)
+                    {
+                        state_t const s = order[i];
+                        for(auto const &e : trie[s])
+                        {
+                            state_t const t = e.second;
+                            fail_[t] = s == 0 ? 0 : this->next(fail_[s], e.first, std::false_type{});
+                            outs[t].insert(outs[t].end(), outs[fail_[t]].begin(), outs[fail_[t]].end());
+                            order.push_back(t);
+                        }
+                    }
+                    this->build_table(trie, order, dense_t{});
+
+                    out_off_.reserve(outs.size() + 1);
+                    out_off_.push_back(0);
+                    for(auto const &o : outs)
+                    {
+                        out_ids_.insert(out_ids_.end(), o.begin(), o.end());
+                        out_off_.push_back(out_ids_.size());
+                    }
+                }
+                state_t next(state_t s, T const &c) const
+                {
+                    return this->next(s, c, dense_t{});
+                }
+                std::size_t out_begin(state_t s) const
+                {
+                    return out_off_[s];
+                }
+                std::size_t out_end(state_t s) const
+                {
+                    return out_off_[s + 1];
+                }
+                std::size_t pattern(std::size_t out) const
+                {
+                    return out_ids_[out];
+                }
+                std::ptrdiff_t length(std::size_t id) const
+                {
+                    return lengths_[id];
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// The matches of a set of patterns in a text, as
+        /// `(pattern index, position)` pairs, where the position is the offset
+        /// of the first element of the match from the start of the text. The
+        /// automaton is built once, when the view is constructed, and is
+        /// shared by copies of the view. The text is read once, in order, so
+        /// it may be an input range. Matches are ordered by where they end;
+        /// matches that end at the same element are ordered longest first.
+        template<typename Rng>
+        struct find_all_view
+          : view_facade<find_all_view<Rng>, is_finite<Rng>::value ? finite : unknown>
+        {
+        private:
+            friend range_access;
+            using automaton_t = detail::aho_corasick<range_value_t<Rng>>;
+            Rng rng_;
+            std::shared_ptr<automaton_t const> ac_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                friend range_access; friend find_all_view;
+                template<typename T>
+                using constify_if = meta::invoke<meta::add_const_if_c<IsConst>, T>;
+                using CRng = constify_if<Rng>;
+                using I = range_iterator_t<CRng>;
+                using S = range_sentinel_t<CRng>;
+                using D = range_difference_t<CRng>;
+                using single_pass = SinglePass<I>;
+
+                automaton_t const *ac_;
+                I it_;
+                S end_;
+                std::uint32_t state_;
+                D pos_;
+                // The matches ending at the element before it_ that are yet to
+                // be visited.
+                std::size_t out_;
+                std::size_t out_end_;
+
+                // Feeds text to the automaton until a state with matches.
+                void scan()
+                {
+                    while(it_ != end_)
+                    {
+                        state_ = ac_->next(state_, *it_);
+                        ++it_;
+                        ++pos_;
+                        out_ = ac_->out_begin(state_);
+                        out_end_ = ac_->out_end(state_);
+                        if(out_ != out_end_)
+                            return;
+                    }
+                }
+                std::pair<std::size_t, D> read() const
+                {
+                    auto const id = ac_->pattern(out_);
+                    return {id, pos_ - static_cast<D>(ac_->length(id))};
+                }
+                void next()
+                {
+                    if(++out_ == out_end_)
+                        this->scan();
+                }
+                bool equal(default_sentinel) const
+                {
+                    return out_ == out_end_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return pos_ == that.pos_ && out_ == that.out_;
+                }
+                cursor(automaton_t const &ac, I first, S last)
+                  : ac_(&ac), it_(first), end_(last), state_(0), pos_(0), out_(0), out_end_(0)
+                {
+                    this->scan();
+                }
+            public:
+                cursor() = default;
+            };
+            cursor<false> begin_cursor()
+            {
+                return {*ac_, ranges::begin(rng_), ranges::end(rng_)};
+            }
+            CONCEPT_REQUIRES(Range<Rng const>())
+            cursor<true> begin_cursor() const
+            {
+                return {*ac_, ranges::begin(rng_), ranges::end(rng_)};
+            }
+        public:
+            find_all_view() = default;
+            template<typename Pats>
+            find_all_view(Rng rng, Pats &&pats)
+              : rng_(std::move(rng))
+              , ac_(std::make_shared<automaton_t>(std::forward<Pats>(pats)))
+            {}
+            Rng base() const
+            {
+                return rng_;
+            }
+        };
+
+        namespace view
+        {
+            struct find_all_fn
+            {
+            private:
+                friend view_access;
+                template<typename Pats>
+                static auto bind(find_all_fn find_all, Pats pats)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(find_all, std::placeholders::_1, std::move(pats)))
+                )
+            public:
+                template<typename Rng, typename Pats>
+                using Concept = meta::and_<
+                    InputRange<Rng>,
+                    TotallyOrdered<range_value_t<Rng>>,
+                    InputRange<Pats>,
+                    InputRange<range_reference_t<Pats>>,
+                    ConvertibleTo<
+                        range_reference_t<range_reference_t<Pats>>,
+                        range_value_t<Rng>>>;
+
+                template<typename Rng, typename Pats,
+                    CONCEPT_REQUIRES_(Concept<Rng, Pats>())>
+                find_all_view<all_t<Rng>> operator()(Rng && rng, Pats && pats) const
+                {
+                    return {all(std::forward<Rng>(rng)), std::forward<Pats>(pats)};
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename Pats,
+                    CONCEPT_REQUIRES_(!Concept<Rng, Pats>())>
+                void operator()(Rng &&, Pats &&) const
+                {
+                    CONCEPT_ASSERT_MSG(InputRange<Rng>(),
+                        "The text on which view::find_all operates must be a model of the "
+                        "InputRange concept.");
+                    CONCEPT_ASSERT_MSG(TotallyOrdered<range_value_t<Rng>>(),
+                        "The elements of the text passed to view::find_all must be "
+                        "TotallyOrdered.");
+                    CONCEPT_ASSERT_MSG(meta::and_<InputRange<Pats>,
+                            InputRange<range_reference_t<Pats>>>(),
+                        "The patterns passed to view::find_all must be a range of ranges.");
+                }
+            #endif
+            };
+
+            /// \relates find_all_fn
+            /// \ingroup group-views
+            RANGES_INLINE_VARIABLE(view<find_all_fn>, find_all)
+        }
+        /// @}
+    }
+}
+
+RANGES_SATISFY_BOOST_RANGE(::ranges::v3::find_all_view)
+
+#endif
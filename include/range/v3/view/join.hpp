@@ -81,13 +81,19 @@ namespace ranges
             {
                 return detail::join_cardinality<Rng>::value;
             }
-            CONCEPT_REQUIRES(detail::join_cardinality<Rng>::value < 0 &&
-                range_cardinality<Rng>::value >= 0 && ForwardRange<Rng>() &&
-                SizedRange<range_reference_t<Rng>>())
+            template<typename BaseRng = Rng,
+                CONCEPT_REQUIRES_(detail::join_cardinality<BaseRng>::value < 0 &&
+                    range_cardinality<BaseRng>::value >= 0 &&
+                    ForwardRange<BaseRng const>() &&
+                    SizedRange<range_reference_t<BaseRng const>>())>
             size_type size() const
             {
                 return accumulate(view::transform(outer_, ranges::size), size_type{0});
             }
+            Rng base() const
+            {
+                return outer_;
+            }
         private:
             friend range_access;
             using Outer = view::all_t<Rng>;
@@ -166,7 +172,8 @@ namespace ranges
             CONCEPT_ASSERT(SemiRegular<concepts::Common::value_t<
                 range_value_t<range_reference_t<Rng>>,
                 range_value_t<ValRng>>>());
-            using size_type = common_type_t<range_size_t<Rng>, range_size_t<range_value_t<Rng>>>;
+            using size_type = common_type_t<range_size_t<Rng>,
+                range_size_t<range_reference_t<Rng>>, range_size_t<ValRng>>;
 
             join_view() = default;
             join_view(Rng rng, ValRng val)
@@ -178,15 +185,27 @@ namespace ranges
             {
                 return detail::join_cardinality<Rng, ValRng>::value;
             }
-            CONCEPT_REQUIRES(detail::join_cardinality<Rng, ValRng>::value < 0 &&
-                range_cardinality<Rng>::value >= 0 && ForwardRange<Rng>() &&
-                SizedRange<range_reference_t<Rng>>() && SizedRange<ValRng>())
+            template<typename BaseRng = Rng,
+                CONCEPT_REQUIRES_(detail::join_cardinality<BaseRng, ValRng>::value < 0 &&
+                    range_cardinality<BaseRng>::value >= 0 &&
+                    ForwardRange<BaseRng const>() &&
+                    SizedRange<range_reference_t<BaseRng const>>() &&
+                    SizedRange<ValRng const>())>
             size_type size() const
             {
                 return accumulate(view::transform(outer_, ranges::size), size_type{0}) +
-                        (range_cardinality<Rng>::value == 0 ?
-                            0 :
-                            ranges::size(val_) * (range_cardinality<Rng>::value - 1));;
+                    (range_cardinality<Rng>::value == 0 ?
+                        0 :
+                        static_cast<size_type>(ranges::size(val_)) *
+                            (range_cardinality<Rng>::value - 1));
+            }
+            Rng base() const
+            {
+                return outer_;
+            }
+            view::all_t<ValRng> separator() const
+            {
+                return val_;
             }
         private:
             friend range_access;
@@ -0,0 +1,234 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_LINES_REVERSE_HPP
+#define RANGES_V3_VIEW_LINES_REVERSE_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/detail/satisfy_boost_range.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/iterator_range.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Returns the start of the line that ends at last: the position
+            // after the last newline in [first, last), or first if there is none.
+            template<typename I>
+            I line_start(I first, I last, std::false_type)
+            {
+                for(; last != first; --last)
+                    if(*ranges::prev(last) == '\n')
+                        break;
+                return last;
+            }
+            template<typename T>
+            T *line_start(T *first, T *last, std::true_type)
+            {
+            #ifdef __GLIBC__
+                if(first == last)
+                    return last;
+                auto const p = static_cast<T *>(::memrchr(first, '\n',
+                    static_cast<std::size_t>(last - first)));
+                return p ? p + 1 : first;
+            #else
+                return detail::line_start(first, last, std::false_type{});
+            #endif
+            }
+
+            // Returns the end of the line that starts at first: the position
+            // of the first newline in [first, last), or last if there is none.
+            template<typename I>
+            I line_end(I first, I last)
+            {
+                return std::find(first, last, '\n');
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// The lines of a range of characters, last line first. Lines are
+        /// found by scanning backward from the end, so reading the last few
+        /// lines of a large memory-mapped file touches only its tail. The
+        /// lines are subranges without their newline; a newline at the very
+        /// end does not start an empty last line. Decrementing an iterator
+        /// moves to the following line of the source.
+        template<typename Rng>
+        struct lines_reverse_view
+          : view_facade<lines_reverse_view<Rng>, is_finite<Rng>::value ? finite : unknown>
+        {
+        private:
+            friend range_access;
+            Rng rng_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                friend range_access; friend lines_reverse_view;
+                template<typename T>
+                using constify_if = meta::invoke<meta::add_const_if_c<IsConst>, T>;
+                using CRng = constify_if<Rng>;
+                using I = range_iterator_t<CRng>;
+                using FastPath = meta::strict_and<
+                    std::is_pointer<I>,
+                    meta::bool_<sizeof(range_value_t<CRng>) == 1>,
+                    std::is_integral<range_value_t<CRng>>>;
+
+                I begin_;
+                I end_;
+                // The current line is [first_, last_). Past the first line of
+                // the source, first_ == last_ == begin_ and done_ is set.
+                I first_;
+                I last_;
+                bool done_;
+
+                iterator_range<I> read() const
+                {
+                    return {first_, last_};
+                }
+                void next()
+                {
+                    if(first_ == begin_)
+                    {
+                        last_ = begin_;
+                        done_ = true;
+                        return;
+                    }
+                    last_ = ranges::prev(first_);
+                    first_ = detail::line_start(begin_, last_, FastPath{});
+                }
+                void prev()
+                {
+                    if(done_)
+                    {
+                        first_ = begin_;
+                        done_ = false;
+                    }
+                    else
+                        first_ = ranges::next(last_);
+                    last_ = detail::line_end(first_, end_);
+                }
+                bool equal(cursor const &that) const
+                {
+                    return done_ == that.done_ && last_ == that.last_;
+                }
+                cursor(I begin, I end, bool done)
+                  : begin_(begin), end_(end), first_(begin), last_(begin), done_(done)
+                {
+                    if(done_)
+                        return;
+                    // The source's last line, without a trailing newline.
+                    last_ = end_;
+                    if(last_ == begin_)
+                        done_ = true;
+                    else if(*ranges::prev(last_) == '\n')
+                        --last_;
+                    first_ = detail::line_start(begin_, last_, FastPath{});
+                }
+            public:
+                cursor() = default;
+            };
+            cursor<false> begin_cursor()
+            {
+                return {ranges::begin(rng_), ranges::end(rng_), false};
+            }
+            cursor<false> end_cursor()
+            {
+                return {ranges::begin(rng_), ranges::end(rng_), true};
+            }
+            CONCEPT_REQUIRES(BoundedRange<Rng const>())
+            cursor<true> begin_cursor() const
+            {
+                return {ranges::begin(rng_), ranges::end(rng_), false};
+            }
+            CONCEPT_REQUIRES(BoundedRange<Rng const>())
+            cursor<true> end_cursor() const
+            {
+                return {ranges::begin(rng_), ranges::end(rng_), true};
+            }
+        public:
+            lines_reverse_view() = default;
+            explicit lines_reverse_view(Rng rng)
+              : rng_(std::move(rng))
+            {}
+            Rng base() const
+            {
+                return rng_;
+            }
+        };
+
+        namespace view
+        {
+            struct lines_reverse_fn
+            {
+                template<typename Rng>
+                using Concept = meta::and_<
+                    BidirectionalRange<Rng>,
+                    BoundedRange<Rng>,
+                    EqualityComparable<range_value_t<Rng>, char>>;
+
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(Concept<Rng>())>
+                lines_reverse_view<all_t<Rng>> operator()(Rng && rng) const
+                {
+                    return lines_reverse_view<all_t<Rng>>{all(std::forward<Rng>(rng))};
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(!Concept<Rng>())>
+                void operator()(Rng &&) const
+                {
+                    CONCEPT_ASSERT_MSG(BidirectionalRange<Rng>(),
+                        "The object on which view::lines_reverse operates must be a model of the "
+                        "BidirectionalRange concept.");
+                    CONCEPT_ASSERT_MSG(BoundedRange<Rng>(),
+                        "The object on which view::lines_reverse operates must be a model of the "
+                        "BoundedRange concept.");
+                    CONCEPT_ASSERT_MSG(EqualityComparable<range_value_t<Rng>, char>(),
+                        "The elements of the range passed to view::lines_reverse must be "
+                        "comparable to char.");
+                }
+            #endif
+            };
+
+            /// \relates lines_reverse_fn
+            /// \ingroup group-views
+            RANGES_INLINE_VARIABLE(view<lines_reverse_fn>, lines_reverse)
+        }
+        /// @}
+    }
+}
+
+RANGES_SATISFY_BOOST_RANGE(::ranges::v3::lines_reverse_view)
+
+#endif
@@ -0,0 +1,250 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_RLE_DECODE_HPP
+#define RANGES_V3_VIEW_RLE_DECODE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+#include <vector>
+#include <meta/meta.hpp>
+#include <range/v3/detail/satisfy_boost_range.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/concepts.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            struct RunLengthPair_
+            {
+                template<typename T>
+                auto requires_(T &&t) -> decltype(
+                    concepts::valid_expr(
+                        ((void)std::get<0>(static_cast<T &&>(t)), 42),
+                        concepts::convertible_to<std::ptrdiff_t>(std::get<1>(static_cast<T &&>(t)))
+                    ));
+            };
+
+            template<typename T>
+            using RunLengthPair = concepts::models<RunLengthPair_, T>;
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// Expands a range of `(value, count)` pairs into `count` copies of each
+        /// `value`. A table of prefix counts is built once, when the view is
+        /// constructed, so the view knows its size without expanding the runs,
+        /// and seeks by binary search when the runs are random-access. Copies
+        /// of the view share the table.
+        template<typename Rng>
+        struct rle_decode_view
+          : view_facade<rle_decode_view<Rng>, finite>
+        {
+        private:
+            friend range_access;
+            Rng rng_;
+            // (*prefix_)[i] is the number of elements in the first i runs.
+            std::shared_ptr<std::vector<std::ptrdiff_t> const> prefix_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                friend range_access; friend rle_decode_view;
+                template<typename T>
+                using constify_if = meta::invoke<meta::add_const_if_c<IsConst>, T>;
+                using CRng = constify_if<Rng>;
+                using I = range_iterator_t<CRng>;
+                using run_ref_t = range_reference_t<CRng>;
+                using value_ref_t = decltype(std::get<0>(std::declval<run_ref_t>()));
+                // Runs that are not lvalues are copied out of.
+                using reference_t = meta::if_<
+                    std::is_lvalue_reference<run_ref_t>,
+                    value_ref_t,
+                    uncvref_t<value_ref_t>>;
+
+                std::vector<std::ptrdiff_t> const *prefix_;
+                I it_;
+                std::ptrdiff_t run_;
+                std::ptrdiff_t pos_;
+
+                std::ptrdiff_t run_end() const
+                {
+                    return (*prefix_)[static_cast<std::size_t>(run_ + 1)];
+                }
+                std::ptrdiff_t run_begin() const
+                {
+                    return (*prefix_)[static_cast<std::size_t>(run_)];
+                }
+                std::ptrdiff_t runs() const
+                {
+                    return static_cast<std::ptrdiff_t>(prefix_->size()) - 1;
+                }
+                // Moves forward past any runs that end at or before pos_.
+                void settle()
+                {
+                    for(; run_ < runs() && run_end() <= pos_; ++run_)
+                        ++it_;
+                }
+                reference_t read() const
+                {
+                    return std::get<0>(*it_);
+                }
+                void next()
+                {
+                    ++pos_;
+                    this->settle();
+                }
+                CONCEPT_REQUIRES(BidirectionalIterator<I>())
+                void prev()
+                {
+                    --pos_;
+                    for(; run_begin() > pos_; --run_)
+                        --it_;
+                }
+                CONCEPT_REQUIRES(RandomAccessIterator<I>())
+                void advance(std::ptrdiff_t n)
+                {
+                    pos_ += n;
+                    auto const run = static_cast<std::ptrdiff_t>(
+                        std::upper_bound(prefix_->begin(), prefix_->end(), pos_) -
+                        prefix_->begin()) - 1;
+                    it_ += static_cast<range_difference_t<CRng>>(run - run_);
+                    run_ = run;
+                }
+                std::ptrdiff_t distance_to(cursor const &that) const
+                {
+                    return that.pos_ - pos_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return pos_ == that.pos_;
+                }
+                cursor(std::vector<std::ptrdiff_t> const &prefix, I it, std::ptrdiff_t run,
+                    std::ptrdiff_t pos)
+                  : prefix_(&prefix), it_(it), run_(run), pos_(pos)
+                {
+                    this->settle();
+                }
+            public:
+                cursor() = default;
+            };
+            cursor<false> begin_cursor()
+            {
+                return {*prefix_, ranges::begin(rng_), 0, 0};
+            }
+            cursor<false> end_cursor()
+            {
+                return {*prefix_, ranges::next(ranges::begin(rng_), ranges::end(rng_)),
+                    static_cast<std::ptrdiff_t>(runs()), prefix_->back()};
+            }
+            CONCEPT_REQUIRES(Range<Rng const>())
+            cursor<true> begin_cursor() const
+            {
+                return {*prefix_, ranges::begin(rng_), 0, 0};
+            }
+            CONCEPT_REQUIRES(Range<Rng const>())
+            cursor<true> end_cursor() const
+            {
+                return {*prefix_, ranges::next(ranges::begin(rng_), ranges::end(rng_)),
+                    static_cast<std::ptrdiff_t>(runs()), prefix_->back()};
+            }
+        public:
+            rle_decode_view() = default;
+            explicit rle_decode_view(Rng rng)
+              : rng_(std::move(rng))
+            {
+                std::vector<std::ptrdiff_t> prefix(1, 0);
+                for(auto it = ranges::begin(rng_), e = ranges::end(rng_); it != e; ++it)
+                {
+                    std::ptrdiff_t const n = std::get<1>(*it);
+                    RANGES_EXPECT(0 <= n);
+                    prefix.push_back(prefix.back() + n);
+                }
+                prefix_ = std::make_shared<std::vector<std::ptrdiff_t> const>(
+                    std::move(prefix));
+            }
+            std::size_t size() const
+            {
+                return static_cast<std::size_t>(prefix_->back());
+            }
+            /// The number of runs.
+            std::size_t runs() const
+            {
+                return prefix_->size() - 1;
+            }
+            Rng base() const
+            {
+                return rng_;
+            }
+        };
+
+        namespace view
+        {
+            struct rle_decode_fn
+            {
+                template<typename Rng>
+                using Concept = meta::and_<
+                    ForwardRange<Rng>,
+                    detail::RunLengthPair<range_reference_t<Rng>>>;
+
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(Concept<Rng>())>
+                rle_decode_view<all_t<Rng>> operator()(Rng && rng) const
+                {
+                    return rle_decode_view<all_t<Rng>>{all(std::forward<Rng>(rng))};
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(!Concept<Rng>())>
+                void operator()(Rng &&) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardRange<Rng>(),
+                        "The object on which view::rle_decode operates must be a model of the "
+                        "ForwardRange concept.");
+                    CONCEPT_ASSERT_MSG(detail::RunLengthPair<range_reference_t<Rng>>(),
+                        "The elements of the range passed to view::rle_decode must be "
+                        "(value, count) pairs whose count is convertible to std::ptrdiff_t.");
+                }
+            #endif
+            };
+
+            /// \relates rle_decode_fn
+            /// \ingroup group-views
+            RANGES_INLINE_VARIABLE(view<rle_decode_fn>, rle_decode)
+        }
+        /// @}
+    }
+}
+
+RANGES_SATISFY_BOOST_RANGE(::ranges::v3::rle_decode_view)
+
+#endif
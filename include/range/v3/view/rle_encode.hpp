@@ -0,0 +1,217 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_RLE_ENCODE_HPP
+#define RANGES_V3_VIEW_RLE_ENCODE_HPP
+
+#include <utility>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/detail/satisfy_boost_range.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Returns the end of the run of elements equal to *p in [p, end).
+            // Whole blocks are compared without early exit so that the
+            // comparisons can be vectorized.
+            template<typename T>
+            T const *rle_run_end(T const *p, T const *end)
+            {
+                constexpr std::ptrdiff_t block = 32;
+                T const v = *p++;
+                while(end - p >= block)
+                {
+                    int diff = 0;
+                    for(std::ptrdiff_t k = 0; k < block; ++k)
+                        diff |= p[k] != v;
+                    if(diff)
+                        break;
+                    p += block;
+                }
+                while(p != end && *p == v)
+                    ++p;
+                return p;
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+        template<typename Rng, typename Proj>
+        struct rle_encode_view
+          : view_facade<
+                rle_encode_view<Rng, Proj>,
+                is_finite<Rng>::value ? finite : range_cardinality<Rng>::value>
+        {
+        private:
+            friend range_access;
+            Rng rng_;
+            semiregular_t<Proj> proj_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                friend range_access; friend rle_encode_view;
+                template<typename T>
+                using constify_if = meta::invoke<meta::add_const_if_c<IsConst>, T>;
+                using CRng = constify_if<Rng>;
+                using I = range_iterator_t<CRng>;
+                using S = range_sentinel_t<CRng>;
+                using D = range_difference_t<CRng>;
+                using FastPath = meta::strict_and<
+                    std::is_same<Proj, ident>,
+                    ContiguousRange<CRng>,
+                    SizedSentinel<S, I>,
+                    std::is_arithmetic<range_value_t<CRng>>>;
+
+                I cur_;
+                I next_;
+                D count_;
+                S last_;
+                semiregular_ref_or_val_t<Proj, IsConst> proj_;
+
+                // Finds the end of the run starting at cur_.
+                void scan(std::false_type)
+                {
+                    next_ = cur_;
+                    count_ = 0;
+                    if(cur_ == last_)
+                        return;
+                    for(++next_, ++count_; next_ != last_; ++next_, ++count_)
+                        if(!(invoke(proj_, *cur_) == invoke(proj_, *next_)))
+                            break;
+                }
+                void scan(std::true_type)
+                {
+                    next_ = cur_;
+                    count_ = 0;
+                    if(cur_ == last_)
+                        return;
+                    auto const p = std::addressof(*cur_);
+                    count_ = static_cast<D>(detail::rle_run_end(p, p + (last_ - cur_)) - p);
+                    next_ = cur_ + count_;
+                }
+                std::pair<range_value_t<CRng>, D> read() const
+                {
+                    return {*cur_, count_};
+                }
+                void next()
+                {
+                    cur_ = next_;
+                    this->scan(FastPath{});
+                }
+                bool equal(default_sentinel) const
+                {
+                    return cur_ == last_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return cur_ == that.cur_;
+                }
+                cursor(semiregular_ref_or_val_t<Proj, IsConst> proj, I first, S last)
+                  : cur_(first), next_(first), count_(0), last_(last), proj_(proj)
+                {
+                    this->scan(FastPath{});
+                }
+            public:
+                cursor() = default;
+            };
+            cursor<false> begin_cursor()
+            {
+                return {proj_, ranges::begin(rng_), ranges::end(rng_)};
+            }
+            CONCEPT_REQUIRES(Range<Rng const>())
+            cursor<true> begin_cursor() const
+            {
+                return {proj_, ranges::begin(rng_), ranges::end(rng_)};
+            }
+        public:
+            rle_encode_view() = default;
+            rle_encode_view(Rng rng, Proj proj)
+              : rng_(std::move(rng))
+              , proj_(std::move(proj))
+            {}
+            Rng base() const
+            {
+                return rng_;
+            }
+        };
+
+        namespace view
+        {
+            struct rle_encode_fn
+            {
+            private:
+                friend view_access;
+                template<typename Proj, CONCEPT_REQUIRES_(!Range<Proj>())>
+                static auto bind(rle_encode_fn rle_encode, Proj proj)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(rle_encode, std::placeholders::_1, std::move(proj)))
+                )
+            public:
+                template<typename Rng, typename Proj>
+                using Concept = meta::and_<
+                    ForwardRange<Rng>,
+                    IndirectRelation<equal_to, projected<range_iterator_t<Rng>, Proj>>>;
+
+                template<typename Rng, typename Proj = ident,
+                    CONCEPT_REQUIRES_(Concept<Rng, Proj>())>
+                rle_encode_view<all_t<Rng>, Proj> operator()(Rng && rng, Proj proj = Proj{}) const
+                {
+                    return {all(std::forward<Rng>(rng)), std::move(proj)};
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename Proj = ident,
+                    CONCEPT_REQUIRES_(Range<Rng>() && !Concept<Rng, Proj>())>
+                void operator()(Rng &&, Proj = Proj{}) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardRange<Rng>(),
+                        "The object on which view::rle_encode operates must be a model of the "
+                        "ForwardRange concept.");
+                    CONCEPT_ASSERT_MSG(IndirectRelation<equal_to,
+                            projected<range_iterator_t<Rng>, Proj>>(),
+                        "The projected elements of the range passed to view::rle_encode must be "
+                        "EqualityComparable.");
+                }
+            #endif
+            };
+
+            /// \relates rle_encode_fn
+            /// \ingroup group-views
+            RANGES_INLINE_VARIABLE(view<rle_encode_fn>, rle_encode)
+        }
+        /// @}
+    }
+}
+
+RANGES_SATISFY_BOOST_RANGE(::ranges::v3::rle_encode_view)
+
+#endif
@@ -14,10 +14,13 @@
 #ifndef RANGES_V3_VIEW_SAMPLE_HPP
 #define RANGES_V3_VIEW_SAMPLE_HPP
 
+#include <memory>
+#include <vector>
 #include <meta/meta.hpp>
 #include <range/v3/detail/satisfy_boost_range.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/view_facade.hpp>
+#include <range/v3/algorithm/sample.hpp>
 #include <range/v3/algorithm/shuffle.hpp>
 #include <range/v3/utility/compressed_pair.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
@@ -103,16 +106,47 @@ namespace ranges
                 using base_t::current;
                 using base_t::range;
                 using base_t::size;
+                using RandomAccess = RandomAccessRange<Rng const>;
+
+                // For random-access ranges, the sorted positions of a sample
+                // that is small next to the population, chosen when iteration
+                // begins, and the next one to visit. Shared between copies.
+                std::shared_ptr<std::vector<D> const> positions_;
+                std::size_t next_position_ = 0;
 
                 D pop_size()
                 {
                     RANGES_EXPECT(range());
                     return size().get(range()->range(), current());
                 }
+                void choose_positions(std::false_type)
+                {}
+                void choose_positions(std::true_type)
+                {
+                    auto const n = pop_size();
+                    D const k = range()->size();
+                    if (k > 0 && detail::sample_by_position(n, k))
+                    {
+                        positions_ = std::make_shared<std::vector<D> const>(
+                            detail::sample_positions(n, k, range()->engine().get()));
+                    }
+                }
+                bool seek(std::false_type)
+                {
+                    return false;
+                }
+                bool seek(std::true_type)
+                {
+                    if (!positions_)
+                        return false;
+                    current() = ranges::begin(range()->range()) +
+                        (*positions_)[next_position_++];
+                    return true;
+                }
                 void advance()
                 {
                     RANGES_EXPECT(range());
-                    if (range()->size() > 0)
+                    if (range()->size() > 0 && !seek(RandomAccess{}))
                     {
                         using Dist = std::uniform_int_distribution<D>;
                         using Param_t = typename Dist::param_type;
@@ -141,6 +175,7 @@ namespace ranges
                     auto n = pop_size();
                     if (rng.size() > n)
                         rng.size() = n;
+                    choose_positions(RandomAccess{});
                     advance();
                 }
                 range_reference_t<Rng> read() const
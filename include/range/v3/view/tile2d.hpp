@@ -0,0 +1,525 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_TILE2D_HPP
+#define RANGES_V3_VIEW_TILE2D_HPP
+
+#include <cstddef>
+#include <functional>
+#include <meta/meta.hpp>
+#include <range/v3/detail/satisfy_boost_range.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/data.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/span.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// A random-access range of `size()` elements that are `stride()` elements
+        /// apart in memory; e.g., a column of a row-major matrix.
+        template<typename T>
+        struct strided_span
+          : view_facade<strided_span<T>, finite>
+        {
+        private:
+            friend range_access;
+            T *data_ = nullptr;
+            std::ptrdiff_t size_ = 0;
+            std::ptrdiff_t stride_ = 1;
+
+            // Iterate by index so that we never form a pointer past the end of
+            // the underlying storage.
+            struct cursor
+            {
+            private:
+                T *data_;
+                std::ptrdiff_t stride_;
+                std::ptrdiff_t pos_;
+            public:
+                cursor() = default;
+                cursor(T *data, std::ptrdiff_t stride, std::ptrdiff_t pos)
+                  : data_(data), stride_(stride), pos_(pos)
+                {}
+                T &read() const
+                {
+                    return data_[pos_ * stride_];
+                }
+                bool equal(cursor const &that) const
+                {
+                    return pos_ == that.pos_;
+                }
+                void next()
+                {
+                    ++pos_;
+                }
+                void prev()
+                {
+                    --pos_;
+                }
+                void advance(std::ptrdiff_t n)
+                {
+                    pos_ += n;
+                }
+                std::ptrdiff_t distance_to(cursor const &that) const
+                {
+                    return that.pos_ - pos_;
+                }
+            };
+            cursor begin_cursor() const
+            {
+                return {data_, stride_, 0};
+            }
+            cursor end_cursor() const
+            {
+                return {data_, stride_, size_};
+            }
+        public:
+            strided_span() = default;
+            constexpr strided_span(T *data, std::ptrdiff_t size, std::ptrdiff_t stride)
+              : data_(data)
+              , size_((RANGES_EXPECT(0 <= size), size))
+              , stride_((RANGES_EXPECT(0 < stride), stride))
+            {}
+            constexpr std::size_t size() const
+            {
+                return static_cast<std::size_t>(size_);
+            }
+            constexpr std::ptrdiff_t stride() const
+            {
+                return stride_;
+            }
+        };
+
+        /// A `height()` by `width()` block of a row-major matrix whose rows start
+        /// `pitch()` elements apart, viewed as a random-access range of contiguous
+        /// rows. The tiles of a `view::tile2d` are `rows_view`s.
+        template<typename T>
+        struct rows_view
+          : view_facade<rows_view<T>, finite>
+        {
+        private:
+            friend range_access;
+            template<typename U>
+            friend struct cols_view;
+            template<typename U>
+            friend struct tile2d_view;
+            T *data_ = nullptr;
+            std::ptrdiff_t height_ = 0;
+            std::ptrdiff_t width_ = 0;
+            std::ptrdiff_t pitch_ = 0;
+
+            struct cursor
+            {
+            private:
+                T *data_;
+                std::ptrdiff_t width_;
+                std::ptrdiff_t pitch_;
+                std::ptrdiff_t row_;
+            public:
+                cursor() = default;
+                cursor(rows_view const &rng, std::ptrdiff_t row)
+                  : data_(rng.data_), width_(rng.width_), pitch_(rng.pitch_), row_(row)
+                {}
+                span<T> read() const
+                {
+                    return {data_ + row_ * pitch_, width_};
+                }
+                bool equal(cursor const &that) const
+                {
+                    return row_ == that.row_;
+                }
+                void next()
+                {
+                    ++row_;
+                }
+                void prev()
+                {
+                    --row_;
+                }
+                void advance(std::ptrdiff_t n)
+                {
+                    row_ += n;
+                }
+                std::ptrdiff_t distance_to(cursor const &that) const
+                {
+                    return that.row_ - row_;
+                }
+            };
+            cursor begin_cursor() const
+            {
+                return {*this, 0};
+            }
+            cursor end_cursor() const
+            {
+                return {*this, height_};
+            }
+        public:
+            rows_view() = default;
+            rows_view(T *data, std::ptrdiff_t height, std::ptrdiff_t width,
+                    std::ptrdiff_t pitch)
+              : data_(data)
+              , height_((RANGES_EXPECT(0 <= height), height))
+              , width_((RANGES_EXPECT(0 <= width), width))
+              , pitch_((RANGES_EXPECT(width <= pitch), pitch))
+            {}
+            std::size_t size() const
+            {
+                return static_cast<std::size_t>(height_);
+            }
+            std::ptrdiff_t height() const
+            {
+                return height_;
+            }
+            std::ptrdiff_t width() const
+            {
+                return width_;
+            }
+            std::ptrdiff_t pitch() const
+            {
+                return pitch_;
+            }
+        };
+
+        /// The columns of a block of a row-major matrix, as a random-access range
+        /// of `strided_span`s.
+        template<typename T>
+        struct cols_view
+          : view_facade<cols_view<T>, finite>
+        {
+        private:
+            friend range_access;
+            rows_view<T> rows_;
+
+            struct cursor
+            {
+            private:
+                rows_view<T> rows_;
+                std::ptrdiff_t col_;
+            public:
+                cursor() = default;
+                cursor(cols_view const &rng, std::ptrdiff_t col)
+                  : rows_(rng.rows_), col_(col)
+                {}
+                strided_span<T> read() const
+                {
+                    return {rows_.data_ + col_, rows_.height_, rows_.pitch_};
+                }
+                bool equal(cursor const &that) const
+                {
+                    return col_ == that.col_;
+                }
+                void next()
+                {
+                    ++col_;
+                }
+                void prev()
+                {
+                    --col_;
+                }
+                void advance(std::ptrdiff_t n)
+                {
+                    col_ += n;
+                }
+                std::ptrdiff_t distance_to(cursor const &that) const
+                {
+                    return that.col_ - col_;
+                }
+            };
+            cursor begin_cursor() const
+            {
+                return {*this, 0};
+            }
+            cursor end_cursor() const
+            {
+                return {*this, rows_.height() == 0 ? 0 : rows_.width()};
+            }
+        public:
+            cols_view() = default;
+            explicit cols_view(rows_view<T> rows)
+              : rows_(rows)
+            {}
+            std::size_t size() const
+            {
+                return static_cast<std::size_t>(rows_.height() == 0 ? 0 : rows_.width());
+            }
+        };
+
+        /// The `tile_height()` by `tile_width()` tiles of a block of a row-major
+        /// matrix, in row-major order. Tiles along the bottom and right edges are
+        /// truncated to fit.
+        template<typename T>
+        struct tile2d_view
+          : view_facade<tile2d_view<T>, finite>
+        {
+        private:
+            friend range_access;
+            rows_view<T> rows_;
+            std::ptrdiff_t tile_height_ = 1;
+            std::ptrdiff_t tile_width_ = 1;
+            std::ptrdiff_t tiles_across_ = 0;
+            std::ptrdiff_t tiles_down_ = 0;
+
+            struct cursor
+            {
+            private:
+                rows_view<T> rows_;
+                std::ptrdiff_t tile_height_;
+                std::ptrdiff_t tile_width_;
+                std::ptrdiff_t tiles_across_;
+                std::ptrdiff_t tile_;
+            public:
+                cursor() = default;
+                cursor(tile2d_view const &rng, std::ptrdiff_t tile)
+                  : rows_(rng.rows_), tile_height_(rng.tile_height_)
+                  , tile_width_(rng.tile_width_), tiles_across_(rng.tiles_across_)
+                  , tile_(tile)
+                {}
+                rows_view<T> read() const
+                {
+                    return tile2d_view::tile_at(rows_, tile_height_, tile_width_,
+                        tile_ / tiles_across_, tile_ % tiles_across_);
+                }
+                bool equal(cursor const &that) const
+                {
+                    return tile_ == that.tile_;
+                }
+                void next()
+                {
+                    ++tile_;
+                }
+                void prev()
+                {
+                    --tile_;
+                }
+                void advance(std::ptrdiff_t n)
+                {
+                    tile_ += n;
+                }
+                std::ptrdiff_t distance_to(cursor const &that) const
+                {
+                    return that.tile_ - tile_;
+                }
+            };
+            cursor begin_cursor() const
+            {
+                return {*this, 0};
+            }
+            cursor end_cursor() const
+            {
+                return {*this, tiles_down_ * tiles_across_};
+            }
+            static std::ptrdiff_t tile_count(std::ptrdiff_t n, std::ptrdiff_t tile)
+            {
+                return (n + tile - 1) / tile;
+            }
+            static rows_view<T> tile_at(rows_view<T> const &rows, std::ptrdiff_t tile_height,
+                std::ptrdiff_t tile_width, std::ptrdiff_t i, std::ptrdiff_t j)
+            {
+                std::ptrdiff_t const row = i * tile_height, col = j * tile_width;
+                std::ptrdiff_t const height = rows.height() - row, width = rows.width() - col;
+                return {rows.data_ + row * rows.pitch_ + col,
+                    height < tile_height ? height : tile_height,
+                    width < tile_width ? width : tile_width,
+                    rows.pitch_};
+            }
+        public:
+            tile2d_view() = default;
+            tile2d_view(rows_view<T> rows, std::ptrdiff_t tile_height, std::ptrdiff_t tile_width)
+              : rows_(rows)
+              , tile_height_((RANGES_EXPECT(0 < tile_height), tile_height))
+              , tile_width_((RANGES_EXPECT(0 < tile_width), tile_width))
+              , tiles_across_(tile_count(rows.width(), tile_width))
+              , tiles_down_(tile_count(rows.height(), tile_height))
+            {}
+            std::size_t size() const
+            {
+                return static_cast<std::size_t>(tiles_down_ * tiles_across_);
+            }
+            std::ptrdiff_t tile_height() const
+            {
+                return tile_height_;
+            }
+            std::ptrdiff_t tile_width() const
+            {
+                return tile_width_;
+            }
+            std::ptrdiff_t tiles_across() const
+            {
+                return tiles_across_;
+            }
+            std::ptrdiff_t tiles_down() const
+            {
+                return tiles_down_;
+            }
+            /// \pre `0 <= i && i < tiles_down() && 0 <= j && j < tiles_across()`
+            rows_view<T> tile(std::ptrdiff_t i, std::ptrdiff_t j) const
+            {
+                RANGES_EXPECT(0 <= i && i < tiles_down_);
+                RANGES_EXPECT(0 <= j && j < tiles_across_);
+                return tile_at(rows_, tile_height_, tile_width_, i, j);
+            }
+        };
+
+        /// \cond
+        namespace detail
+        {
+            // An lvalue container, or a view, whose elements outlive the call.
+            template<typename Rng>
+            using MatrixStorage = meta::strict_and<SizedRange<Rng>, ContiguousRange<Rng>,
+                meta::or_<std::is_lvalue_reference<Rng>, View<uncvref_t<Rng>>>>;
+
+            template<typename Rng>
+            using matrix_element_t = concepts::ContiguousRange::datum_t<Rng>;
+
+            template<typename T, typename Rng>
+            rows_view<T> as_rows(Rng &rng, std::ptrdiff_t width)
+            {
+                RANGES_EXPECT(0 < width);
+                auto const n = static_cast<std::ptrdiff_t>(ranges::size(rng));
+                RANGES_EXPECT(0 == n % width);
+                return {ranges::data(rng), n / width, width, width};
+            }
+        }
+        /// \endcond
+
+        namespace view
+        {
+            // In:  ContiguousRange<T> holding a row-major matrix `width` elements wide
+            // Out: RandomAccessRange<span<T>>, one per row
+            struct rows_fn
+            {
+            private:
+                friend view_access;
+                template<typename Int,
+                    CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(rows_fn rows, Int width)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(rows, std::placeholders::_1,
+                        static_cast<std::ptrdiff_t>(width)))
+                )
+            public:
+                template<typename Rng,
+                    typename T = detail::matrix_element_t<Rng>,
+                    CONCEPT_REQUIRES_(detail::MatrixStorage<Rng>())>
+                rows_view<T> operator()(Rng && rng, std::ptrdiff_t width) const
+                {
+                    return detail::as_rows<T>(rng, width);
+                }
+            };
+
+            // In:  ContiguousRange<T> holding a row-major matrix `width` elements wide,
+            //      or a rows_view<T>
+            // Out: RandomAccessRange<strided_span<T>>, one per column
+            struct cols_fn
+            {
+            private:
+                friend view_access;
+                template<typename Int,
+                    CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(cols_fn cols, Int width)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(cols, std::placeholders::_1,
+                        static_cast<std::ptrdiff_t>(width)))
+                )
+            public:
+                template<typename Rng,
+                    typename T = detail::matrix_element_t<Rng>,
+                    CONCEPT_REQUIRES_(detail::MatrixStorage<Rng>())>
+                cols_view<T> operator()(Rng && rng, std::ptrdiff_t width) const
+                {
+                    return cols_view<T>{detail::as_rows<T>(rng, width)};
+                }
+                template<typename T>
+                cols_view<T> operator()(rows_view<T> rows) const
+                {
+                    return cols_view<T>{rows};
+                }
+            };
+
+            // In:  ContiguousRange<T> holding a row-major matrix `width` elements wide,
+            //      or a rows_view<T>
+            // Out: RandomAccessRange<rows_view<T>>, one per tile in row-major order
+            struct tile2d_fn
+            {
+            private:
+                friend view_access;
+                template<typename W, typename H, typename X,
+                    CONCEPT_REQUIRES_(Integral<W>() && Integral<H>() && Integral<X>())>
+                static auto bind(tile2d_fn tile2d, W width, H tile_height, X tile_width)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(tile2d, std::placeholders::_1,
+                        static_cast<std::ptrdiff_t>(width),
+                        static_cast<std::ptrdiff_t>(tile_height),
+                        static_cast<std::ptrdiff_t>(tile_width)))
+                )
+                template<typename H, typename X,
+                    CONCEPT_REQUIRES_(Integral<H>() && Integral<X>())>
+                static auto bind(tile2d_fn tile2d, H tile_height, X tile_width)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(tile2d, std::placeholders::_1,
+                        static_cast<std::ptrdiff_t>(tile_height),
+                        static_cast<std::ptrdiff_t>(tile_width)))
+                )
+            public:
+                template<typename Rng,
+                    typename T = detail::matrix_element_t<Rng>,
+                    CONCEPT_REQUIRES_(detail::MatrixStorage<Rng>())>
+                tile2d_view<T> operator()(Rng && rng, std::ptrdiff_t width,
+                    std::ptrdiff_t tile_height, std::ptrdiff_t tile_width) const
+                {
+                    return {detail::as_rows<T>(rng, width), tile_height, tile_width};
+                }
+                template<typename T>
+                tile2d_view<T> operator()(rows_view<T> rows, std::ptrdiff_t tile_height,
+                    std::ptrdiff_t tile_width) const
+                {
+                    return {rows, tile_height, tile_width};
+                }
+            };
+
+            /// \relates rows_fn
+            /// \ingroup group-views
+            RANGES_INLINE_VARIABLE(view<rows_fn>, rows)
+
+            /// \relates cols_fn
+            /// \ingroup group-views
+            RANGES_INLINE_VARIABLE(view<cols_fn>, cols)
+
+            /// \relates tile2d_fn
+            /// \ingroup group-views
+            RANGES_INLINE_VARIABLE(view<tile2d_fn>, tile2d)
+        }
+        /// @}
+    }
+}
+
+RANGES_SATISFY_BOOST_RANGE(::ranges::v3::strided_span)
+RANGES_SATISFY_BOOST_RANGE(::ranges::v3::rows_view)
+RANGES_SATISFY_BOOST_RANGE(::ranges::v3::cols_view)
+RANGES_SATISFY_BOOST_RANGE(::ranges::v3::tile2d_view)
+
+#endif
@@ -61,6 +61,7 @@ namespace ranges
         {
         private:
             friend range_access;
+            friend detail::elementwise_access;
             semiregular_t<Fun> fun_;
             using use_sentinel_t =
                 meta::or_<meta::not_<BoundedRange<Rng>>, SinglePass<range_iterator_t<Rng>>>;
@@ -147,6 +148,7 @@ namespace ranges
         {
         private:
             friend range_access;
+            friend detail::elementwise_access;
             semiregular_t<Fun> fun_;
             Rng1 rng1_;
             Rng2 rng2_;
@@ -133,6 +133,7 @@ namespace ranges
         {
         private:
             friend range_access;
+            friend detail::elementwise_access;
             semiregular_t<Fun> fun_;
             std::tuple<Rngs...> rngs_;
             using difference_type_ = common_type_t<range_difference_t<Rngs>...>;
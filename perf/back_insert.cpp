@@ -0,0 +1,145 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares copy, transform and merge into back_inserter(vector), which
+// reserve room for sized inputs and insert forward ranges in one go, with
+// the standard algorithms writing through std::back_inserter.
+//
+// Usage: back_insert [elements, default 4096] [total elements, default 1e9]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <vector>
+#include <range/v3/all.hpp>
+#include "perf_counters.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+class timer
+{
+public:
+    using clock_t = std::chrono::high_resolution_clock;
+    using duration_t = clock_t::time_point::duration;
+
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = clock_t::now();
+    }
+    duration_t elapsed() const
+    {
+        return clock_t::now() - start_;
+    }
+private:
+    clock_t::time_point start_;
+};
+
+template<typename D>
+double to_seconds(D d) {
+  return std::chrono::duration_cast<std::chrono::duration<double>>(d).count();
+}
+
+// Runs f reps times and prints the time per element.
+template<typename F>
+void benchmark(char const *name, F f, std::size_t n, std::size_t reps)
+{
+    timer t;
+    auto const counts = perf_counters::instance().measure([&]
+    {
+        for(std::size_t j = 0; j < reps; ++j)
+            f();
+    });
+    double const elements = static_cast<double>(n) * static_cast<double>(reps);
+    std::cout << name << (to_seconds(t.elapsed()) * 1e9 / elements) << " ns/element";
+    if(perf_counters::enabled())
+    {
+        std::cout << "  ";
+        perf_counters::report(std::cout, counts, elements);
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    std::size_t const n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4096;
+    double const total = argc > 2 ? std::strtod(argv[2], nullptr) : 1e9;
+    std::size_t const reps = static_cast<std::size_t>(total / static_cast<double>(n)) + 1;
+    std::vector<int> a(n);
+    std::list<int> l;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = static_cast<int>(i);
+        l.push_back(static_cast<int>(i));
+    }
+    auto const twice = [](int x) { return 2 * x; };
+    long sink = 0;
+
+    std::cout << "Appending " << n << " ints to an empty vector:" << std::endl;
+    benchmark("std::copy, vector     : ", [&]
+    {
+        std::vector<int> v;
+        std::copy(a.begin(), a.end(), std::back_inserter(v));
+        sink += v[n / 2];
+    }, n, reps);
+    benchmark("copy, vector          : ", [&]
+    {
+        std::vector<int> v;
+        copy(a, back_inserter(v));
+        sink += v[n / 2];
+    }, n, reps);
+    benchmark("std::copy, list       : ", [&]
+    {
+        std::vector<int> v;
+        std::copy(l.begin(), l.end(), std::back_inserter(v));
+        sink += v[n / 2];
+    }, n, reps);
+    benchmark("copy, list            : ", [&]
+    {
+        std::vector<int> v;
+        copy(l, back_inserter(v));
+        sink += v[n / 2];
+    }, n, reps);
+    benchmark("std::transform        : ", [&]
+    {
+        std::vector<int> v;
+        std::transform(a.begin(), a.end(), std::back_inserter(v), twice);
+        sink += v[n / 2];
+    }, n, reps);
+    benchmark("transform             : ", [&]
+    {
+        std::vector<int> v;
+        transform(a, back_inserter(v), twice);
+        sink += v[n / 2];
+    }, n, reps);
+    benchmark("std::merge            : ", [&]
+    {
+        std::vector<int> v;
+        std::merge(a.begin(), a.end(), a.begin(), a.end(), std::back_inserter(v));
+        sink += v[n / 2];
+    }, 2 * n, reps);
+    benchmark("merge                 : ", [&]
+    {
+        std::vector<int> v;
+        merge(a, a, back_inserter(v));
+        sink += v[n / 2];
+    }, 2 * n, reps);
+    if(sink == 42)
+        std::cout << "";
+}
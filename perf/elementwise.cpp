@@ -0,0 +1,130 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares arithmetic zip_with/transform pipelines over arrays of doubles,
+// copied with the flat indexed loop used for elementwise functions and
+// through the views' iterators, against a hand-written loop.
+//
+// Usage: elementwise [elements, default 4096] [total elements, default 1e9]
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <range/v3/all.hpp>
+#include "perf_counters.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+class timer
+{
+public:
+    using clock_t = std::chrono::high_resolution_clock;
+    using duration_t = clock_t::time_point::duration;
+
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = clock_t::now();
+    }
+    duration_t elapsed() const
+    {
+        return clock_t::now() - start_;
+    }
+private:
+    clock_t::time_point start_;
+};
+
+template<typename D>
+double to_seconds(D d) {
+  return std::chrono::duration_cast<std::chrono::duration<double>>(d).count();
+}
+
+// Runs f reps times and prints the time per element.
+template<typename F>
+void benchmark(char const *name, F f, std::size_t n, std::size_t reps)
+{
+    timer t;
+    auto const counts = perf_counters::instance().measure([&]
+    {
+        for(std::size_t j = 0; j < reps; ++j)
+            f();
+    });
+    double const elements = static_cast<double>(n) * static_cast<double>(reps);
+    std::cout << name << (to_seconds(t.elapsed()) * 1e9 / elements) << " ns/element";
+    if(perf_counters::enabled())
+    {
+        std::cout << "  ";
+        perf_counters::report(std::cout, counts, elements);
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    std::size_t const n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4096;
+    double const total = argc > 2 ? std::strtod(argv[2], nullptr) : 1e9;
+    std::size_t const reps = static_cast<std::size_t>(total / static_cast<double>(n)) + 1;
+    std::vector<double> a(n), b(n), out(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = static_cast<double>(i);
+        b[i] = static_cast<double>(n - i);
+    }
+    auto const twice = [](double x) { return 2 * x; };
+    double sink = 0;
+
+    std::cout << "a + 2 * b over " << n << " doubles:" << std::endl;
+    benchmark("raw loop              : ", [&]
+    {
+        double const *pa = a.data(), *pb = b.data();
+        double *po = out.data();
+        for(std::size_t i = 0; i < n; ++i)
+            po[i] = pa[i] + 2 * pb[i];
+        sink += po[n / 2];
+    }, n, reps);
+    benchmark("copy, elementwise     : ", [&]
+    {
+        copy(view::zip_with(plus{}, a, view::transform(b, elementwise(twice))), out.begin());
+        sink += out[n / 2];
+    }, n, reps);
+    benchmark("copy, iterators       : ", [&]
+    {
+        copy(view::zip_with([](double x, double y) { return x + y; }, a,
+            view::transform(b, twice)), out.begin());
+        sink += out[n / 2];
+    }, n, reps);
+    benchmark("raw loop, new vector  : ", [&]
+    {
+        std::vector<double> v(n);
+        for(std::size_t i = 0; i < n; ++i)
+            v[i] = a[i] + 2 * b[i];
+        sink += v[n / 2];
+    }, n, reps);
+    benchmark("to_vector, elementwise: ", [&]
+    {
+        auto v = view::zip_with(plus{}, a, view::transform(b, elementwise(twice))) | to_vector;
+        sink += v[n / 2];
+    }, n, reps);
+    benchmark("to_vector, iterators  : ", [&]
+    {
+        auto v = view::zip_with([](double x, double y) { return x + y; }, a,
+            view::transform(b, twice)) | to_vector;
+        sink += v[n / 2];
+    }, n, reps);
+    if(sink == 42)
+        std::cout << "";
+}
@@ -0,0 +1,127 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares find_first_of over text for a few delimiters and over integers
+// for a set of values, using the lookup tables for integers, against the
+// same searches with a predicate, which compares each element with each
+// needle.
+//
+// Usage: find_first_of [elements, default 65536] [total elements, default 1e9]
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <range/v3/all.hpp>
+#include "perf_counters.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+class timer
+{
+public:
+    using clock_t = std::chrono::high_resolution_clock;
+    using duration_t = clock_t::time_point::duration;
+
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = clock_t::now();
+    }
+    duration_t elapsed() const
+    {
+        return clock_t::now() - start_;
+    }
+private:
+    clock_t::time_point start_;
+};
+
+template<typename D>
+double to_seconds(D d) {
+  return std::chrono::duration_cast<std::chrono::duration<double>>(d).count();
+}
+
+// Runs f reps times and prints the time per element.
+template<typename F>
+void benchmark(char const *name, F f, std::size_t n, std::size_t reps)
+{
+    timer t;
+    auto const counts = perf_counters::instance().measure([&]
+    {
+        for(std::size_t j = 0; j < reps; ++j)
+            f();
+    });
+    double const elements = static_cast<double>(n) * static_cast<double>(reps);
+    std::cout << name << (to_seconds(t.elapsed()) * 1e9 / elements) << " ns/element";
+    if(perf_counters::enabled())
+    {
+        std::cout << "  ";
+        perf_counters::report(std::cout, counts, elements);
+    }
+    std::cout << std::endl;
+}
+
+// Disables the lookup tables.
+struct equal_values
+{
+    template<typename T>
+    bool operator()(T a, T b) const
+    {
+        return a == b;
+    }
+};
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    std::size_t const n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 65536;
+    double const total = argc > 2 ? std::strtod(argv[2], nullptr) : 1e9;
+    std::size_t const reps = static_cast<std::size_t>(total / static_cast<double>(n)) + 1;
+    std::string text(n, 'x');
+    std::vector<int> ints(n, 1);
+    std::size_t sink = 0;
+
+    std::string const delims = ",;\"\n";
+    std::cout << "Finding one of " << delims.size() << " delimiters in " << n << " chars:"
+        << std::endl;
+    benchmark("table      : ", [&]
+    {
+        sink += static_cast<std::size_t>(find_first_of(text, delims) - text.begin());
+    }, n, reps);
+    benchmark("predicate  : ", [&]
+    {
+        sink += static_cast<std::size_t>(find_first_of(text, delims, equal_values{}) - text.begin());
+    }, n, reps);
+
+    for(int m : {3, 4, 8, 64})
+    {
+        std::vector<int> needles;
+        for(int i = 0; i < m; ++i)
+            needles.push_back(i * 7919 + 2);
+        std::cout << "Finding one of " << m << " ints in " << n << " ints:" << std::endl;
+        benchmark("default    : ", [&]
+        {
+            sink += static_cast<std::size_t>(find_first_of(ints, needles) - ints.begin());
+        }, n, reps);
+        benchmark("predicate  : ", [&]
+        {
+            sink += static_cast<std::size_t>(find_first_of(ints, needles, equal_values{}) -
+                ints.begin());
+        }, n, reps);
+    }
+    if(sink == 42)
+        std::cout << "";
+}
@@ -0,0 +1,166 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares replace, replace_if, reverse, swap_ranges and transform over
+// arrays of arithmetic values, using the kernels for the processor, against
+// the portable loops, selected with a projection or with the vectors'
+// iterators, and against the standard algorithms. Set RANGES_CPU_ISA to
+// compare instruction sets.
+//
+// Usage: mutating_kernels [elements, default 16384] [total elements, default 1e9]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <range/v3/all.hpp>
+#include "perf_counters.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+class timer
+{
+public:
+    using clock_t = std::chrono::high_resolution_clock;
+    using duration_t = clock_t::time_point::duration;
+
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = clock_t::now();
+    }
+    duration_t elapsed() const
+    {
+        return clock_t::now() - start_;
+    }
+private:
+    clock_t::time_point start_;
+};
+
+template<typename D>
+double to_seconds(D d) {
+  return std::chrono::duration_cast<std::chrono::duration<double>>(d).count();
+}
+
+// Runs f reps times and prints the time per element.
+template<typename F>
+void benchmark(char const *name, F f, std::size_t n, std::size_t reps)
+{
+    timer t;
+    auto const counts = perf_counters::instance().measure([&]
+    {
+        for(std::size_t j = 0; j < reps; ++j)
+            f();
+    });
+    double const elements = static_cast<double>(n) * static_cast<double>(reps);
+    std::cout << name << (to_seconds(t.elapsed()) * 1e9 / elements) << " ns/element";
+    if(perf_counters::enabled())
+    {
+        std::cout << "  ";
+        perf_counters::report(std::cout, counts, elements);
+    }
+    std::cout << std::endl;
+}
+
+// Disables the kernels.
+struct same
+{
+    template<typename T>
+    T operator()(T t) const
+    {
+        return t;
+    }
+};
+
+template<typename T>
+void run(char const *type, std::size_t n, std::size_t reps)
+{
+    using namespace ranges;
+    std::vector<T> a(n), b(n), out(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = static_cast<T>(i % 64);
+        b[i] = static_cast<T>(i % 100);
+    }
+    auto const small = [](T t) { return t < T(2); };
+    auto const affine = [](T t) { return static_cast<T>(t * 3 + 1); };
+    auto const difference = [](T x, T y) { return static_cast<T>(x - y); };
+    double sink = 0;
+
+    // Each run undoes the previous one, so the data stays the same.
+    T x = T(1), y = T(70);
+    std::cout << "replace, " << n << " " << type << ":" << std::endl;
+    benchmark("  kernel   : ", [&] { replace(a, x, y); std::swap(x, y); }, n, reps);
+    benchmark("  portable : ", [&] { replace(a, x, y, same{}); std::swap(x, y); }, n, reps);
+    benchmark("  std      : ", [&] { std::replace(a.begin(), a.end(), x, y); std::swap(x, y); },
+        n, reps);
+
+    // Replaces the elements that are 0 or 1 with 1.
+    std::cout << "replace_if, " << n << " " << type << ":" << std::endl;
+    benchmark("  kernel   : ", [&] { replace_if(a, small, T(1)); }, n, reps);
+    benchmark("  portable : ", [&] { replace_if(a, small, T(1), same{}); }, n, reps);
+    benchmark("  std      : ", [&] { std::replace_if(a.begin(), a.end(), small, T(1)); }, n, reps);
+
+    std::cout << "reverse, " << n << " " << type << ":" << std::endl;
+    benchmark("  kernel   : ", [&] { reverse(a); }, n, reps);
+    benchmark("  portable : ", [&] { reverse(a.begin(), a.end()); }, n, reps);
+    benchmark("  std      : ", [&] { std::reverse(a.begin(), a.end()); }, n, reps);
+
+    std::cout << "swap_ranges, " << n << " " << type << ":" << std::endl;
+    benchmark("  kernel   : ", [&] { swap_ranges(a, b); }, n, reps);
+    benchmark("  portable : ", [&] { swap_ranges(a.begin(), a.end(), b.begin()); }, n, reps);
+    benchmark("  std      : ", [&] { std::swap_ranges(a.begin(), a.end(), b.begin()); }, n, reps);
+
+    std::cout << "transform t * 3 + 1, " << n << " " << type << ":" << std::endl;
+    benchmark("  kernel   : ", [&] { transform(a, out.begin(), affine); sink += out[n / 2]; },
+        n, reps);
+    benchmark("  portable : ", [&] { transform(a, out.begin(), affine, same{}); sink += out[n / 2]; },
+        n, reps);
+    benchmark("  std      : ", [&]
+    {
+        std::transform(a.begin(), a.end(), out.begin(), affine);
+        sink += out[n / 2];
+    }, n, reps);
+
+    std::cout << "transform a - b, " << n << " " << type << ":" << std::endl;
+    benchmark("  kernel   : ", [&] { transform(a, b, out.begin(), difference); sink += out[n / 2]; },
+        n, reps);
+    benchmark("  portable : ", [&]
+    {
+        transform(a, b, out.begin(), difference, same{});
+        sink += out[n / 2];
+    }, n, reps);
+    benchmark("  std      : ", [&]
+    {
+        std::transform(a.begin(), a.end(), b.begin(), out.begin(), difference);
+        sink += out[n / 2];
+    }, n, reps);
+    if(sink == 42)
+        std::cout << "";
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t const n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 16384;
+    double const total = argc > 2 ? std::strtod(argv[2], nullptr) : 1e9;
+    std::size_t const reps = static_cast<std::size_t>(total / static_cast<double>(n)) + 1;
+    static char const *const names[] = {"baseline", "sse4.2", "avx2", "avx512"};
+    std::cout << "Kernels for " << names[static_cast<int>(ranges::active_cpu_isa())] << std::endl;
+    run<char>("chars", n, reps);
+    run<int>("ints", n, reps);
+    run<float>("floats", n, reps);
+    run<double>("doubles", n, reps);
+}
@@ -0,0 +1,154 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures the bandwidth of ranges::copy, fill and transform with ordinary and
+// streaming stores, and how much each slows down a co-running thread whose
+// working set fits in the last-level cache.
+//
+// Usage: nontemporal [MiB to write, default 512] [co-runner KiB, default 4096]
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <range/v3/all.hpp>
+#include "perf_counters.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+class timer
+{
+public:
+    using clock_t = std::chrono::high_resolution_clock;
+    using duration_t = clock_t::time_point::duration;
+
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = clock_t::now();
+    }
+    duration_t elapsed() const
+    {
+        return clock_t::now() - start_;
+    }
+private:
+    clock_t::time_point start_;
+};
+
+template<typename D>
+double to_seconds(D d) {
+  return std::chrono::duration_cast<std::chrono::duration<double>>(d).count();
+}
+
+constexpr int cloops = 5;
+
+// Sums a cache-resident array over and over until told to stop, counting
+// the passes.
+struct co_runner
+{
+    std::vector<long> data_;
+    std::atomic<bool> stop_{false};
+    std::atomic<long> passes_{0};
+    std::thread thread_;
+
+    explicit co_runner(std::size_t kib)
+      : data_(kib * 1024 / sizeof(long), 1)
+    {
+        thread_ = std::thread([this]
+        {
+            long sink = 0;
+            while(!stop_.load(std::memory_order_relaxed))
+            {
+                sink += ranges::accumulate(data_, 0L);
+                passes_.fetch_add(1, std::memory_order_relaxed);
+            }
+            if(sink == 42)
+                std::cout << "";
+        });
+    }
+    ~co_runner()
+    {
+        stop_ = true;
+        thread_.join();
+    }
+};
+
+// Runs f cloops times and prints its bandwidth, and the co-runner's passes
+// per second while it ran.
+template<typename F>
+void benchmark(char const *name, F f, std::size_t bytes, co_runner *co)
+{
+    timer::duration_t total = {};
+    long passes = 0;
+    perf_counters::sample counts;
+    for(int j = 0; j < cloops; ++j)
+    {
+        long const before = co ? co->passes_.load() : 0;
+        timer t;
+        counts += perf_counters::instance().measure(f);
+        total += t.elapsed();
+        passes += co ? co->passes_.load() - before : 0;
+    }
+    double const secs = to_seconds(total);
+    std::cout << name << (static_cast<double>(bytes) * cloops / secs / 1e9) << " GB/s";
+    if(co)
+        std::cout << ", co-runner " << (static_cast<double>(passes) / secs) << " passes/s";
+    if(perf_counters::enabled())
+    {
+        std::cout << "  ";
+        perf_counters::report(std::cout, counts,
+            static_cast<double>(bytes / sizeof(int) * cloops));
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t const mib = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 512;
+    std::size_t const co_kib = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 4096;
+    std::size_t const n = mib * 1024 * 1024 / sizeof(int);
+    std::vector<int> src(n, 1), dst(n);
+    std::size_t const bytes = n * sizeof(int);
+    auto const always = ranges::nontemporal_t{0};
+    auto const plus1 = [](int i) { return i + 1; };
+
+    std::cout << "nontemporal threshold: " << ranges::nontemporal.threshold() << " bytes"
+        << std::endl;
+    for(int with_co = 0; with_co < 2; ++with_co)
+    {
+        std::unique_ptr<co_runner> co;
+        if(with_co)
+        {
+            std::cout << "with a co-runner summing " << co_kib << " KiB:" << std::endl;
+            co.reset(new co_runner(co_kib));
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        benchmark("copy                  : ",
+            [&]{ ranges::copy(src, dst.data()); }, bytes, co.get());
+        benchmark("copy, nontemporal     : ",
+            [&]{ ranges::copy(src, dst.data(), always); }, bytes, co.get());
+        benchmark("fill                  : ",
+            [&]{ ranges::fill(dst, 7); }, bytes, co.get());
+        benchmark("fill, nontemporal     : ",
+            [&]{ ranges::fill(dst, 7, always); }, bytes, co.get());
+        benchmark("transform             : ",
+            [&]{ ranges::transform(src, dst.data(), plus1); }, bytes, co.get());
+        benchmark("transform, nontemporal: ",
+            [&]{ ranges::transform(src, dst.data(), plus1, always); }, bytes, co.get());
+    }
+}
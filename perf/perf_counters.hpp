@@ -0,0 +1,211 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Hardware performance counters for the benchmark programs. Set the
+// environment variable RANGES_PERF_COUNTERS to collect them. They are read
+// with Linux perf_event_open; any counter the kernel or hypervisor will not
+// provide (perf_event_paranoid, virtual machines without a PMU, other
+// systems) is reported as unavailable and the benchmarks run as usual.
+
+#ifndef RANGES_PERF_PERF_COUNTERS_HPP
+#define RANGES_PERF_PERF_COUNTERS_HPP
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+class perf_counters
+{
+public:
+    enum event
+    {
+        cycles,
+        instructions,
+        branch_misses,
+        l1d_misses,
+        llc_misses,
+        event_count
+    };
+
+    // Counts accumulated over one or more measured intervals.
+    struct sample
+    {
+        std::uint64_t value[event_count] = {};
+        bool valid[event_count] = {};
+
+        sample &operator+=(sample const &that)
+        {
+            for(int e = 0; e < event_count; ++e)
+            {
+                value[e] += that.value[e];
+                valid[e] = valid[e] || that.valid[e];
+            }
+            return *this;
+        }
+    };
+
+    static bool enabled()
+    {
+        static bool const on = std::getenv("RANGES_PERF_COUNTERS") != nullptr;
+        return on;
+    }
+
+    perf_counters()
+    {
+        for(int e = 0; e < event_count; ++e)
+            fd_[e] = enabled() ? open_event(static_cast<event>(e)) : -1;
+    }
+    ~perf_counters()
+    {
+    #if defined(__linux__)
+        for(int e = 0; e < event_count; ++e)
+            if(fd_[e] != -1)
+                ::close(fd_[e]);
+    #endif
+    }
+    perf_counters(perf_counters const &) = delete;
+    perf_counters &operator=(perf_counters const &) = delete;
+
+    // Counters for the main thread, opened on first use. They count only
+    // the thread that opened them.
+    static perf_counters &instance()
+    {
+        static perf_counters counters;
+        return counters;
+    }
+
+    void start()
+    {
+    #if defined(__linux__)
+        for(int e = 0; e < event_count; ++e)
+            if(fd_[e] != -1)
+            {
+                ::ioctl(fd_[e], PERF_EVENT_IOC_RESET, 0);
+                ::ioctl(fd_[e], PERF_EVENT_IOC_ENABLE, 0);
+            }
+    #endif
+    }
+    // Stops counting and returns the counts since start(), scaled up if the
+    // kernel had to multiplex the counters.
+    sample stop()
+    {
+        sample s;
+    #if defined(__linux__)
+        for(int e = 0; e < event_count; ++e)
+            if(fd_[e] != -1)
+                ::ioctl(fd_[e], PERF_EVENT_IOC_DISABLE, 0);
+        for(int e = 0; e < event_count; ++e)
+        {
+            std::uint64_t buf[3]; // value, time enabled, time running
+            if(fd_[e] == -1 || ::read(fd_[e], buf, sizeof(buf)) != sizeof(buf) || buf[2] == 0)
+                continue;
+            s.value[e] = buf[2] == buf[1] ? buf[0] :
+                static_cast<std::uint64_t>(static_cast<double>(buf[0]) *
+                    static_cast<double>(buf[1]) / static_cast<double>(buf[2]));
+            s.valid[e] = true;
+        }
+    #endif
+        return s;
+    }
+
+    template<typename F>
+    sample measure(F &&f)
+    {
+        start();
+        f();
+        return stop();
+    }
+
+    // Prints IPC and misses per element, or "n/a" for missing counters.
+    static void report(std::ostream &os, sample const &s, double elements)
+    {
+        auto const flags = os.flags();
+        auto const precision = os.precision();
+        os << std::fixed << std::setprecision(3);
+        os << "IPC ";
+        if(s.valid[cycles] && s.valid[instructions] && s.value[cycles] != 0)
+            os << static_cast<double>(s.value[instructions]) /
+                static_cast<double>(s.value[cycles]);
+        else
+            os << "n/a";
+        static char const *const names[event_count] =
+            {nullptr, nullptr, "branch-misses", "L1d-misses", "LLC-misses"};
+        for(int e = branch_misses; e < event_count; ++e)
+        {
+            os << ", " << names[e] << "/elt ";
+            if(s.valid[e] && elements > 0)
+                os << static_cast<double>(s.value[e]) / elements;
+            else
+                os << "n/a";
+        }
+        os.flags(flags);
+        os.precision(precision);
+    }
+
+private:
+    int fd_[event_count];
+
+    static int open_event(event e)
+    {
+    #if defined(__linux__)
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        switch(e)
+        {
+        case cycles:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case instructions:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case branch_misses:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        case l1d_misses:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_L1D |
+                (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        case llc_misses:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        default:
+            return -1;
+        }
+        long const fd = ::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        return fd < 0 ? -1 : static_cast<int>(fd);
+    #else
+        (void)e;
+        return -1;
+    #endif
+    }
+};
+
+#endif
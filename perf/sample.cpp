@@ -0,0 +1,96 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares ranges::sample of a small subset of a large vector, which chooses
+// positions with Floyd's algorithm, against a pass over the population through
+// forward iterators, which is what every sample used to cost.
+//
+// Usage: sample [population, default 1e7] [sample size, default 100]
+
+#include <chrono>
+#include <cstdlib>
+#include <forward_list>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <range/v3/all.hpp>
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+class timer
+{
+public:
+    using clock_t = std::chrono::high_resolution_clock;
+    using duration_t = clock_t::time_point::duration;
+
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = clock_t::now();
+    }
+    duration_t elapsed() const
+    {
+        return clock_t::now() - start_;
+    }
+private:
+    clock_t::time_point start_;
+};
+
+template<typename D>
+double to_seconds(D d) {
+  return std::chrono::duration_cast<std::chrono::duration<double>>(d).count();
+}
+
+// Runs f reps times and prints the time per sample.
+template<typename F>
+void benchmark(char const *name, F f, std::size_t reps)
+{
+    timer t;
+    for(std::size_t j = 0; j < reps; ++j)
+        f();
+    std::cout << name << (to_seconds(t.elapsed()) * 1e6 / static_cast<double>(reps))
+        << " us/sample" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    std::size_t const n = argc > 1 ? static_cast<std::size_t>(std::strtod(argv[1], nullptr)) : 10000000;
+    std::size_t const k = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 100;
+    std::vector<int> pop = view::ints(0, static_cast<int>(n));
+    std::forward_list<int> list(pop.begin(), pop.end());
+    std::vector<int> out(k);
+    std::mt19937 engine;
+    long sink = 0;
+
+    std::cout << k << " of " << n << " ints:" << std::endl;
+    benchmark("vector, by position : ", [&]
+    {
+        sample(pop, out.begin(), static_cast<std::ptrdiff_t>(k), engine);
+        sink += out[k / 2];
+    }, 1000);
+    benchmark("view::sample, vector: ", [&]
+    {
+        for(int i : pop | view::sample(static_cast<std::ptrdiff_t>(k), engine) | to_vector)
+            sink += i;
+    }, 1000);
+    benchmark("forward_list, pass  : ", [&]
+    {
+        sample(list.begin(), list.end(), out.begin(), static_cast<std::ptrdiff_t>(k), engine);
+        sink += out[k / 2];
+    }, 10);
+    if(sink == 42)
+        std::cout << "";
+}
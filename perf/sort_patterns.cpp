@@ -26,6 +26,7 @@
 #include <chrono>
 #include <algorithm>
 #include <range/v3/all.hpp>
+#include "perf_counters.hpp"
 
 RANGES_DIAGNOSTIC_IGNORE_GLOBAL_CONSTRUCTORS
 RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
@@ -143,6 +144,8 @@ namespace
       duration_t min_t;
       std::size_t size;
       duration_t deviation;
+      perf_counters::sample counts;
+      std::size_t iters;
     };
     std::vector<result_t> results;
 
@@ -155,10 +158,13 @@ namespace
         duration_t deviation;
         duration_t mean_duration;
         std::size_t iter;
+        perf_counters::sample counts;
 
         for (iter = 0; iter < max_iters; ++iter) {
           c.init(size);
-          durations.emplace_back(duration(c));
+          durations.emplace_back(duration([&] {
+            counts += perf_counters::instance().measure(c);
+          }));
           mean_duration = compute_mean(durations);
           if (++iter == max_iters) {
             break;
@@ -171,7 +177,8 @@ namespace
         }
         auto minmax = ranges::minmax(durations);
         results.emplace_back(
-            result_t{mean_duration, minmax.second, minmax.first, size, deviation});
+            result_t{mean_duration, minmax.second, minmax.first, size, deviation,
+                     counts, durations.size()});
         std::cerr << "size: " << size << " iter: " << iter
                   << " dev: " << to_millis(deviation)
                   << " mean: " << to_millis(mean_duration)
@@ -228,6 +235,13 @@ namespace
 
       std::cout << setw(20) << rs.size << setw(20) << to_millis(rs.mean_t)
                 << setw(20) << to_millis(ss.mean_t) << '\n';
+      if (perf_counters::enabled()) {
+        std::cout << "#" << setw(19) << "ranges::sort" << ": ";
+        perf_counters::report(std::cout, rs.counts, double(rs.size * rs.iters));
+        std::cout << "\n#" << setw(19) << "std::sort" << ": ";
+        perf_counters::report(std::cout, ss.counts, double(ss.size * ss.iters));
+        std::cout << '\n';
+      }
     }
   }
 } // unnamed namespace
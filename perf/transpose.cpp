@@ -0,0 +1,128 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <range/v3/all.hpp>
+#include "perf_counters.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+class timer
+{
+public:
+    using clock_t = std::chrono::high_resolution_clock;
+    using duration_t = clock_t::time_point::duration;
+
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = clock_t::now();
+    }
+    duration_t elapsed() const
+    {
+        return clock_t::now() - start_;
+    }
+private:
+    clock_t::time_point start_;
+};
+
+template<typename D>
+std::chrono::microseconds::rep to_micros(D d) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+}
+
+constexpr int cloops = 5;
+
+// Transpose a w x h matrix by walking each source column with view::stride.
+void transpose_stride(std::vector<double> const &src, std::vector<double> &dst,
+    std::ptrdiff_t w, std::ptrdiff_t h)
+{
+    for(std::ptrdiff_t c = 0; c < w; ++c)
+        ranges::copy(src | ranges::view::drop_exactly(c) | ranges::view::stride(w),
+            dst.begin() + c * h);
+}
+
+// Transpose a w x h matrix by walking the columns from view::cols.
+void transpose_cols(std::vector<double> const &src, std::vector<double> &dst,
+    std::ptrdiff_t w, std::ptrdiff_t h)
+{
+    auto cols = ranges::view::cols(src, w);
+    for(std::ptrdiff_t c = 0; c < w; ++c)
+        ranges::copy(cols[c], dst.begin() + c * h);
+}
+
+// Transpose a w x h matrix one 32x32 tile at a time with view::tile2d.
+void transpose_tiles(std::vector<double> const &src, std::vector<double> &dst,
+    std::ptrdiff_t w, std::ptrdiff_t h)
+{
+    auto tiles = ranges::view::tile2d(src, w, 32, 32);
+    for(std::ptrdiff_t t = 0, n = static_cast<std::ptrdiff_t>(tiles.size()); t < n; ++t)
+    {
+        auto tile = tiles[t];
+        std::ptrdiff_t const row0 = (t / tiles.tiles_across()) * 32;
+        std::ptrdiff_t const col0 = (t % tiles.tiles_across()) * 32;
+        for(std::ptrdiff_t r = 0; r < tile.height(); ++r)
+        {
+            auto row = tile[r];
+            for(std::ptrdiff_t c = 0; c < tile.width(); ++c)
+                dst[(col0 + c) * h + row0 + r] = row[c];
+        }
+    }
+}
+
+void transpose_ranges(std::vector<double> const &src, std::vector<double> &dst,
+    std::ptrdiff_t w, std::ptrdiff_t h)
+{
+    ranges::transpose(src, dst, w, h);
+}
+
+template<typename F>
+void benchmark(char const *name, F f, std::ptrdiff_t w, std::ptrdiff_t h)
+{
+    std::vector<double> src(static_cast<std::size_t>(w * h)), dst(src.size());
+    for(std::size_t i = 0; i < src.size(); ++i)
+        src[i] = static_cast<double>(i);
+    timer::duration_t us = {};
+    perf_counters::sample counts;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        counts += perf_counters::instance().measure([&]{ f(src, dst, w, h); });
+        us += t.elapsed();
+    }
+    std::cout << name << to_micros(us/cloops) << "us";
+    if(perf_counters::enabled())
+    {
+        std::cout << "  ";
+        perf_counters::report(std::cout, counts, static_cast<double>(w * h * cloops));
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 3)
+        return -1;
+
+    std::ptrdiff_t w = std::atol(argv[1]);
+    std::ptrdiff_t h = std::atol(argv[2]);
+    benchmark("view::stride      : ", transpose_stride, w, h);
+    benchmark("view::cols        : ", transpose_cols, w, h);
+    benchmark("view::tile2d      : ", transpose_tiles, w, h);
+    benchmark("ranges::transpose : ", transpose_ranges, w, h);
+}
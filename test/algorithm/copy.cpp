@@ -12,6 +12,8 @@
 #include <cstring>
 #include <utility>
 #include <algorithm>
+#include <list>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/view/delimit.hpp>
@@ -67,5 +69,32 @@ int main()
         CHECK(std::strcmp(sz, buf) == 0);
     }
 
+    // Streaming stores, forced with a zero threshold, at odd offsets and
+    // sizes so that the unaligned head and tail are exercised.
+    {
+        std::vector<int> src(10007);
+        for(std::size_t i = 0; i < src.size(); ++i)
+            src[i] = static_cast<int>(i * 3);
+        for(std::ptrdiff_t off : {0, 1, 3})
+        {
+            std::vector<int> dst(src.size() + 4, -1);
+            auto res4 = ranges::copy(src, dst.data() + off, ranges::nontemporal_t{0});
+            CHECK(res4.in() == src.end());
+            CHECK(res4.out() == dst.data() + off + src.size());
+            CHECK(std::equal(src.begin(), src.end(), dst.begin() + off));
+            CHECK(dst[static_cast<std::size_t>(off) + src.size()] == -1);
+        }
+        std::list<int> l(src.begin(), src.begin() + 100);
+        std::vector<long> dst(100);
+        auto res5 = ranges::copy(l, dst.data(), ranges::nontemporal_t{0});
+        CHECK(res5.in() == l.end());
+        CHECK(std::equal(l.begin(), l.end(), dst.begin()));
+        // Below the default threshold, ordinary stores are used.
+        std::vector<int> small(5);
+        CHECK(ranges::copy(src.begin(), src.begin() + 5, small.data(), ranges::nontemporal).out() ==
+            small.data() + 5);
+        CHECK(std::equal(small.begin(), small.end(), src.begin()));
+    }
+
     return test_result();
 }
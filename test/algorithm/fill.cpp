@@ -18,6 +18,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
 #include <cstring>
 #include <string>
 #include <vector>
@@ -96,5 +97,23 @@ int main()
     test_int<bidirectional_iterator<int*>, sentinel<int*> >();
     test_int<random_access_iterator<int*>, sentinel<int*> >();
 
+    // Streaming stores, forced with a zero threshold.
+    {
+        struct rgb { unsigned char r, g, b; };
+        std::vector<rgb> v(5001, rgb{0, 0, 0});
+        auto it = ranges::fill(v, rgb{1, 2, 3}, ranges::nontemporal_t{0});
+        CHECK(it == v.end());
+        for(auto const &c : v)
+            CHECK((c.r == 1 && c.g == 2 && c.b == 3));
+        std::vector<int> w(1003, 0);
+        CHECK(ranges::fill(w.data() + 1, w.data() + 1002, 7, ranges::nontemporal_t{0}) ==
+            w.data() + 1002);
+        CHECK(w.front() == 0);
+        CHECK(w.back() == 0);
+        CHECK(std::count(w.begin(), w.end(), 7) == 1001);
+        CHECK(ranges::fill(w, 9, ranges::nontemporal) == w.end());
+        CHECK(std::count(w.begin(), w.end(), 9) == 1003);
+    }
+
     return ::test_result();
 }
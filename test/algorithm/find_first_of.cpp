@@ -18,6 +18,8 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <string>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/find_first_of.hpp>
 #include "../simple_test.hpp"
@@ -214,6 +216,53 @@ void test_rng_pred_proj()
 }
 
 
+// Integers are looked up in a set of the needles.
+void test_integer_set()
+{
+    using namespace ranges;
+    std::string const text = "key = \"value\\n\"; # comment";
+    char const special[] = {'"', '\\', '#'};
+    CHECK(rng::find_first_of(text, special) == text.begin() + 6);
+    CHECK(rng::find_first_of(text.c_str(), text.c_str() + text.size(),
+        special + 1, special + 3) == text.c_str() + 12);
+    CHECK(rng::find_first_of(input_iterator<const char*>(text.c_str()),
+        sentinel<const char*>(text.c_str() + text.size()),
+        forward_iterator<const char*>(special + 2),
+        sentinel<const char*>(special + 3)) ==
+        input_iterator<const char*>(text.c_str() + 17));
+    signed char const sc[] = {1, -1, -128, 127};
+    signed char const sn[] = {-128};
+    CHECK(rng::find_first_of(sc, sn) == sc + 2);
+
+    // Enough needles to be hashed, with duplicates and negative values.
+    std::vector<long> needles;
+    for(long i = 0; i < 40; ++i)
+        needles.push_back(i * i * 1000003 - 500);
+    needles.push_back(needles.front());
+    std::vector<long> hay(1000, 7);
+    CHECK(rng::find_first_of(hay, needles) == hay.end());
+    hay[300] = 39 * 39 * 1000003 - 500;
+    hay[700] = -500;
+    CHECK(rng::find_first_of(hay, needles) == hay.begin() + 300);
+    CHECK(rng::find_first_of(input_iterator<const long*>(hay.data()),
+        sentinel<const long*>(hay.data() + hay.size()),
+        forward_iterator<const long*>(needles.data()),
+        sentinel<const long*>(needles.data() + 1)) ==
+        input_iterator<const long*>(hay.data() + 700));
+
+    // As many needles as the set holds inline, and one more.
+    for(long n : {64L, 65L})
+    {
+        needles.clear();
+        for(long i = 0; i < n; ++i)
+            needles.push_back(i * 1000 + 1);
+        std::vector<long> hay2(500, 0);
+        CHECK(rng::find_first_of(hay2, needles) == hay2.end());
+        hay2[400] = (n - 1) * 1000 + 1;
+        CHECK(rng::find_first_of(hay2, needles) == hay2.begin() + 400);
+    }
+}
+
 int main()
 {
     ::test_iter();
@@ -221,5 +270,6 @@ int main()
     ::test_rng();
     ::test_rng_pred();
     ::test_rng_pred_proj();
+    ::test_integer_set();
     return ::test_result();
 }
@@ -0,0 +1,84 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <chrono>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/for_each_resumable.hpp>
+#include "../simple_test.hpp"
+
+int main()
+{
+    using ranges::resumable_status;
+    using ranges::work_budget;
+
+    // An element budget processes exactly that many elements per call.
+    {
+        std::vector<int> v{1, 2, 3, 4, 5, 6, 7};
+        int sum = 0;
+        auto st = ranges::for_each_resumable(v, [&](int i){ sum += i; });
+        CHECK(st.resume(work_budget::elements(3)) == resumable_status::suspended);
+        CHECK(sum == 6);
+        CHECK(st.position() == v.begin() + 3);
+        CHECK(st.resume(work_budget::elements(3)) == resumable_status::suspended);
+        CHECK(sum == 21);
+        CHECK(st.resume(work_budget::elements(3)) == resumable_status::done);
+        CHECK(sum == 28);
+        CHECK(st.done());
+        CHECK(st.resume(work_budget::elements(3)) == resumable_status::done);
+        CHECK(sum == 28);
+    }
+
+    // Iterators, projections, and a default (unlimited) budget.
+    {
+        std::vector<std::pair<int, int>> v{{1, 10}, {2, 20}, {3, 30}};
+        int sum = 0;
+        auto st = ranges::for_each_resumable(v.begin(), v.end(),
+            [&](int i){ sum += i; }, &std::pair<int, int>::second);
+        CHECK(st.resume(work_budget{}) == resumable_status::done);
+        CHECK(sum == 60);
+    }
+
+    // An empty range is done at once, even with an empty budget.
+    {
+        std::vector<int> v;
+        auto st = ranges::for_each_resumable(v, [](int){});
+        CHECK(st.resume(work_budget::elements(0)) == resumable_status::done);
+    }
+
+    // A cancelled token stops the algorithm for good.
+    {
+        std::vector<int> v(1000, 1);
+        int sum = 0;
+        auto tok = ranges::make_cancellation_token();
+        auto st = ranges::for_each_resumable(v, [&](int i){ sum += i; if(sum == 500) tok.cancel(); });
+        CHECK(st.resume(work_budget{}, tok) == resumable_status::cancelled);
+        CHECK(sum >= 500);
+        CHECK(sum < 1000);
+        CHECK(st.resume(work_budget{}) == resumable_status::cancelled);
+        CHECK(st.status() == resumable_status::cancelled);
+    }
+
+    // A time budget eventually finishes.
+    {
+        std::vector<int> v(100000, 1);
+        long sum = 0;
+        auto st = ranges::for_each_resumable(v, [&](int i){ sum += i; });
+        int calls = 0;
+        while(st.resume(work_budget::time(std::chrono::microseconds(50))) ==
+            resumable_status::suspended)
+            ++calls;
+        CHECK(sum == 100000);
+        CHECK(calls >= 0);
+    }
+
+    return ::test_result();
+}
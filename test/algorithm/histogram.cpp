@@ -0,0 +1,139 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/histogram.hpp>
+#include <range/v3/view/take.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    int i;
+};
+
+int main()
+{
+    using namespace ranges;
+
+    int ia[] = {0, 1, 2, 2, 0, 1, 2, 3};
+    constexpr unsigned cia = size(ia);
+
+    {
+        int bins[4] = {};
+        auto it = histogram(input_iterator<const int*>(ia),
+            sentinel<const int*>(ia + cia), bins);
+        CHECK(it.base() == ia + cia);
+        ::check_equal(bins, {2, 2, 3, 1});
+
+        // Counts are added to what is already in the bins.
+        CHECK(histogram(ia, bins) == ia + cia);
+        ::check_equal(bins, {4, 4, 6, 2});
+    }
+
+    {
+        S sa[] = {{0}, {1}, {2}, {2}, {0}, {1}, {2}, {3}};
+        std::vector<long> bins(4);
+        histogram(make_iterator_range(input_iterator<const S*>(sa),
+            sentinel<const S*>(sa + size(sa))), bins, &S::i);
+        ::check_equal(bins, {2, 2, 3, 1});
+        for(int b = 0; b < 4; ++b)
+            CHECK(bins[(std::size_t)b] == count(sa, b, &S::i));
+    }
+
+    // Byte fast path
+    {
+        std::string const str = "mississippi";
+        std::vector<int> bins(256);
+        histogram(str, bins);
+        CHECK(bins['m'] == 1);
+        CHECK(bins['i'] == 4);
+        CHECK(bins['s'] == 4);
+        CHECK(bins['p'] == 2);
+        CHECK(count(bins, 0) == 252);
+
+        unsigned char const bytes[] = {0, 255, 255, 128};
+        std::vector<int> bbins(256);
+        histogram(bytes, bbins);
+        CHECK(bbins[0] == 1);
+        CHECK(bbins[128] == 1);
+        CHECK(bbins[255] == 2);
+
+        // Fewer than 256 bins goes through the bucket checks.
+        unsigned char const small[] = {0, 1, 1, 2};
+        int sbins[3] = {};
+        histogram(small, sbins);
+        ::check_equal(sbins, {1, 2, 1});
+
+        // Signed bytes are binned by their unsigned value on both paths.
+        signed char const sbytes[] = {-128, -100, 5, -100};
+        std::vector<int> fewer(200), all(256);
+        histogram(sbytes, fewer);
+        histogram(sbytes, all);
+        CHECK(fewer[128] == 1);
+        CHECK(fewer[156] == 2);
+        CHECK(fewer[5] == 1);
+        CHECK(equal(fewer, view::take(all, 200)));
+        CHECK(count(all, 0) == 253);
+    }
+
+    // Uniform numeric binning
+    {
+        double const da[] = {-1.0, 0.0, 0.1, 0.25, 0.5, 0.99, 1.0, 7.0};
+        uniform_bucket<double> bucket{0.0, 1.0, 4};
+        CHECK(bucket(-1.0) == 0);
+        CHECK(bucket(0.25) == 1);
+        CHECK(bucket(1.0) == 3);
+        int bins[4] = {};
+        histogram(da, bins, bucket);
+        ::check_equal(bins, {3, 1, 1, 3});
+    }
+
+    // Many bins: no private sub-histograms
+    {
+        std::vector<int> data;
+        for(int i = 0; i < 10000; ++i)
+            data.push_back((i * 7919) % 5000);
+        std::vector<int> bins(5000);
+        histogram(data, bins);
+        CHECK(count(bins, 2) == 5000);
+    }
+
+    // Parallel
+    {
+        std::vector<unsigned char> bytes;
+        std::vector<int> values;
+        for(int i = 0; i < 1 << 18; ++i)
+        {
+            bytes.push_back(static_cast<unsigned char>(i));
+            values.push_back(i % 10);
+        }
+        std::vector<int> bbins(256);
+        CHECK(histogram(par, bytes, bbins) == bytes.end());
+        CHECK(count(bbins, 1 << 10) == 256);
+
+        std::vector<long> vbins(10), sbins(10);
+        histogram(par, values, vbins, [](int i) { return i; });
+        histogram(values, sbins, [](int i) { return i; });
+        CHECK(vbins == sbins);
+
+        std::vector<int> empty;
+        histogram(par, empty, vbins);
+        CHECK(vbins == sbins);
+    }
+
+    return ::test_result();
+}
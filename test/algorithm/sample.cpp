@@ -24,7 +24,9 @@
 //===----------------------------------------------------------------------===//
 
 #include <array>
+#include <vector>
 #include <range/v3/core.hpp>
+#include <range/v3/algorithm/adjacent_find.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/algorithm/sample.hpp>
 #include <range/v3/numeric/iota.hpp>
@@ -275,5 +277,35 @@ int main()
         }
     }
 
+    // Small samples of random-access populations are picked by position:
+    // distinct, in order, and each element equally likely.
+    {
+        std::vector<int> pop(1000);
+        ranges::iota(pop, 0);
+        std::minstd_rand g;
+        int sample[10];
+        auto result = ranges::sample(pop, sample, g);
+        CHECK(result.out() == ranges::end(sample));
+        CHECK(result.in() == pop.begin() + sample[9] + 1);
+        CHECK(ranges::adjacent_find(sample, [](int a, int b) { return a >= b; }) ==
+            ranges::end(sample));
+
+        pop.resize(20);
+        std::array<int, 20> hits{};
+        for(int i = 0; i < 4000; ++i)
+        {
+            int two[2];
+            ranges::sample(pop, two, g);
+            CHECK(two[0] < two[1]);
+            ++hits[static_cast<std::size_t>(two[0])];
+            ++hits[static_cast<std::size_t>(two[1])];
+        }
+        for(int h : hits)
+        {
+            CHECK(h > 300);
+            CHECK(h < 500);
+        }
+    }
+
     return ::test_result();
 }
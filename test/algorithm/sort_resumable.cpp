@@ -0,0 +1,139 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/sort_resumable.hpp>
+#include "../simple_test.hpp"
+
+namespace
+{
+    std::vector<int> random_ints(std::size_t n, int hi)
+    {
+        std::mt19937 gen(static_cast<unsigned>(n));
+        std::uniform_int_distribution<int> dist(0, hi);
+        std::vector<int> v(n);
+        for(auto &i : v)
+            i = dist(gen);
+        return v;
+    }
+}
+
+int main()
+{
+    using ranges::resumable_status;
+    using ranges::work_budget;
+
+    // Small budgets, resumed to completion, give the same result as std::sort.
+    for(std::size_t n : {0u, 1u, 31u, 32u, 33u, 100u, 1000u, 4097u})
+    {
+        for(std::ptrdiff_t budget : {1, 7, 64, 1000})
+        {
+            auto v = random_ints(n, 1000);
+            auto expected = v;
+            std::sort(expected.begin(), expected.end());
+            auto st = ranges::sort_resumable(v);
+            int calls = 0;
+            while(st.resume(work_budget::elements(budget)) == resumable_status::suspended)
+                ++calls;
+            CHECK(st.done());
+            CHECK(v == expected);
+            if(n >= 100u && budget == 1)
+                CHECK(calls > 100);
+        }
+    }
+
+    // The sort is stable, and supports predicates, projections and move-only
+    // elements.
+    {
+        auto keys = random_ints(500, 10);
+        std::vector<std::pair<int, int>> v;
+        for(std::size_t i = 0; i < keys.size(); ++i)
+            v.emplace_back(keys[i], static_cast<int>(i));
+        auto expected = v;
+        std::stable_sort(expected.begin(), expected.end(),
+            [](std::pair<int, int> const &a, std::pair<int, int> const &b)
+            { return a.first > b.first; });
+        auto st = ranges::sort_resumable(v, std::greater<int>{}, &std::pair<int, int>::first);
+        while(!st.done())
+            st.resume(work_budget::elements(50));
+        CHECK(v == expected);
+    }
+    {
+        std::vector<std::unique_ptr<int>> v;
+        for(int i : random_ints(300, 100))
+            v.emplace_back(new int(i));
+        auto st = ranges::sort_resumable(v.begin(), v.end(), ranges::ordered_less{},
+            [](std::unique_ptr<int> const &p){ return *p; });
+        while(!st.done())
+            st.resume(work_budget::elements(37));
+        CHECK(std::is_sorted(v.begin(), v.end(),
+            [](std::unique_ptr<int> const &a, std::unique_ptr<int> const &b)
+            { return *a < *b; }));
+    }
+
+    // Cancellation is final.
+    {
+        auto v = random_ints(1000, 1000);
+        auto tok = ranges::make_cancellation_token();
+        auto st = ranges::sort_resumable(v);
+        CHECK(st.resume(work_budget::elements(100), tok) == resumable_status::suspended);
+        tok.cancel();
+        CHECK(st.resume(work_budget{}, tok) == resumable_status::cancelled);
+        CHECK(st.resume(work_budget{}) == resumable_status::cancelled);
+        CHECK(!st.done());
+    }
+
+    // Cancelling at any point leaves a permutation of the input.
+    for(std::ptrdiff_t budget : {0, 500, 1500, 2100, 2999, 3500, 4700, 5999, 6500, 6900})
+    {
+        auto const ints = random_ints(1000, 100);
+        std::vector<std::unique_ptr<int>> v;
+        for(int i : ints)
+            v.emplace_back(new int(i));
+        auto tok = ranges::make_cancellation_token();
+        auto st = ranges::sort_resumable(v.begin(), v.end(), ranges::ordered_less{},
+            [](std::unique_ptr<int> const &p){ return *p; });
+        if(budget != 0)
+            st.resume(work_budget::elements(budget));
+        tok.cancel();
+        CHECK(st.resume(work_budget{}, tok) == resumable_status::cancelled);
+        CHECK(std::none_of(v.begin(), v.end(),
+            [](std::unique_ptr<int> const &p){ return p == nullptr; }));
+        std::vector<int> out;
+        for(auto const &p : v)
+            if(p)
+                out.push_back(*p);
+        auto sorted = ints;
+        std::sort(sorted.begin(), sorted.end());
+        std::sort(out.begin(), out.end());
+        CHECK(out == sorted);
+    }
+
+    // A time budget eventually finishes.
+    {
+        auto v = random_ints(100000, 1 << 20);
+        auto expected = v;
+        std::sort(expected.begin(), expected.end());
+        auto st = ranges::sort_resumable(v);
+        while(st.resume(work_budget::time(std::chrono::microseconds(200))) ==
+            resumable_status::suspended)
+            ;
+        CHECK(v == expected);
+    }
+
+    return ::test_result();
+}
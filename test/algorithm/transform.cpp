@@ -19,6 +19,7 @@
 //===----------------------------------------------------------------------===//
 
 #include <functional>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/transform.hpp>
 #include <range/v3/view/unbounded.hpp>
@@ -424,5 +425,24 @@ int main()
     static_assert(std::is_same<ranges::tagged_tuple<ranges::tag::in1(S const*), ranges::tag::in2(S const *), ranges::tag::out(int*)>,
         decltype(ranges::transform(s, s, p, binary, &S::i, &S::i))>::value, "");
 
+    // Streaming stores, forced with a zero threshold.
+    {
+        std::vector<int> src(9001);
+        for(std::size_t k = 0; k < src.size(); ++k)
+            src[k] = static_cast<int>(k);
+        std::vector<double> dst(src.size() + 1, -1.0);
+        auto res = ranges::transform(src, dst.data() + 1, [](int k){ return k * 0.5; },
+            ranges::nontemporal_t{0});
+        CHECK(res.in() == src.end());
+        CHECK(res.out() == dst.data() + dst.size());
+        CHECK(dst[0] == -1.0);
+        bool ok = true;
+        for(std::size_t k = 0; k < src.size(); ++k)
+            ok = ok && dst[k + 1] == static_cast<double>(k) * 0.5;
+        CHECK(ok);
+        static_assert(std::is_same<ranges::tagged_pair<ranges::tag::in(int const*), ranges::tag::out(int*)>,
+            decltype(ranges::transform(i, i + 4, p, unary, ranges::nontemporal))>::value, "");
+    }
+
     return ::test_result();
 }
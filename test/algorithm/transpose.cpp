@@ -0,0 +1,74 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/transpose.hpp>
+#include <range/v3/view/iota.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+namespace
+{
+    void test_size(std::ptrdiff_t width, std::ptrdiff_t height)
+    {
+        using namespace ranges;
+        std::vector<int> src = view::iota(0, static_cast<int>(width * height));
+        std::vector<int> dst(src.size(), -1);
+        auto res = transpose(src, dst, width, height);
+        CHECK(res.in() == src.end());
+        CHECK(res.out() == dst.end());
+        bool ok = true;
+        for(std::ptrdiff_t r = 0; r < height; ++r)
+            for(std::ptrdiff_t c = 0; c < width; ++c)
+                ok = ok && dst[static_cast<std::size_t>(c * height + r)] ==
+                    src[static_cast<std::size_t>(r * width + c)];
+        CHECK(ok);
+    }
+}
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        int src[] = {0,1,2,
+                     3,4,5};
+        int dst[6] = {};
+        auto res = transpose(src, dst, 3, 2);
+        CHECK(res.in() == src + 6);
+        CHECK(res.out() == dst + 6);
+        ::check_equal(dst, {0,3,1,4,2,5});
+    }
+
+    {
+        int const src[] = {0,1,2,
+                           3,4,5};
+        int dst[6] = {};
+        auto res = transpose(src, dst, 3, 2);
+        CHECK(res.in() == src + 6);
+        CHECK(res.out() == dst + 6);
+        ::check_equal(dst, {0,3,
+                            1,4,
+                            2,5});
+    }
+
+    test_size(0, 0);
+    test_size(1, 1);
+    test_size(1, 100);
+    test_size(100, 1);
+    test_size(16, 16);
+    test_size(17, 33);
+    test_size(64, 48);
+    test_size(129, 257);
+
+    return ::test_result();
+}
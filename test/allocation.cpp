@@ -0,0 +1,315 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+// Checks that views and the algorithms that are not documented to allocate
+// do not touch the heap, and that those that do stay within a fixed number
+// of allocations. Every allocation through operator new is counted, as is
+// every call to posix_memalign where it can be interposed, which catches
+// the temporary buffers of the stable algorithms.
+
+#include <array>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#if defined(__GLIBC__)
+#include <dlfcn.h>
+#endif
+#include <range/v3/all.hpp>
+#include "./simple_test.hpp"
+
+namespace
+{
+    std::size_t allocations = 0;
+
+    void *counted_alloc(std::size_t n)
+    {
+        ++allocations;
+        if(void *p = std::malloc(n ? n : 1))
+            return p;
+        throw std::bad_alloc{};
+    }
+}
+
+void *operator new(std::size_t n)
+{
+    return counted_alloc(n);
+}
+void *operator new[](std::size_t n)
+{
+    return counted_alloc(n);
+}
+void *operator new(std::size_t n, std::nothrow_t const &) noexcept
+{
+    ++allocations;
+    return std::malloc(n ? n : 1);
+}
+void *operator new[](std::size_t n, std::nothrow_t const &) noexcept
+{
+    ++allocations;
+    return std::malloc(n ? n : 1);
+}
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+void operator delete[](void *p) noexcept
+{
+    std::free(p);
+}
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+void operator delete[](void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+#if defined(__GLIBC__)
+extern "C" int posix_memalign(void **p, std::size_t align, std::size_t n)
+{
+    using fn_t = int (*)(void **, std::size_t, std::size_t);
+    static fn_t const real = reinterpret_cast<fn_t>(::dlsym(RTLD_NEXT, "posix_memalign"));
+    ++allocations;
+    return real(p, align, n);
+}
+#endif
+
+template<typename F>
+std::size_t count_allocations(F f)
+{
+    std::size_t const before = allocations;
+    f();
+    return allocations - before;
+}
+
+// Dereferences every element, so that lazily computed elements are built.
+template<typename Rng>
+void walk(Rng && rng)
+{
+    std::size_t n = 0;
+    for(auto i = ranges::begin(rng), e = ranges::end(rng); i != e; ++i, ++n)
+    {
+        auto && x = *i;
+        (void)x;
+    }
+    (void)n;
+}
+
+#define CHECK_NO_ALLOCATION(...) \
+    CHECK(count_allocations([&]{ __VA_ARGS__; }) == 0u)
+
+#define CHECK_ALLOCATIONS_AT_MOST(N, ...) \
+    CHECK(count_allocations([&]{ __VA_ARGS__; }) <= std::size_t(N))
+
+using namespace ranges;
+
+struct is_odd
+{
+    bool operator()(int i) const
+    {
+        return i % 2 == 1;
+    }
+};
+
+struct twice
+{
+    int operator()(int i) const
+    {
+        return 2 * i;
+    }
+};
+
+void test_views()
+{
+    std::vector<int> v = {1, 2, 2, 3, 5, 8, 8, 8, 13, 21, 34, 55};
+    std::vector<int> w = {2, 3, 4, 8, 9, 34, 89};
+    std::vector<int *> ptrs = {&v[0], &v[3], &v[5]};
+    std::vector<std::pair<int, char>> kv = {{1, 'a'}, {2, 'b'}, {3, 'c'}};
+    std::vector<std::pair<char, int>> runs = {{'a', 3}, {'b', 1}, {'c', 2}};
+    std::string text = "one\ntwo\nthree\n";
+    std::array<float, 24> matrix{};
+    std::mt19937 gen;
+    char const *cstr = "hello";
+    int n = 0;
+
+    CHECK_NO_ALLOCATION(walk(view::all(v)));
+    CHECK_NO_ALLOCATION(walk(v | view::adjacent_filter(std::less<int>{})));
+    CHECK_NO_ALLOCATION(walk(v | view::adjacent_remove_if(std::equal_to<int>{})));
+    CHECK_NO_ALLOCATION(walk(view::iota(0, 10) | view::bounded));
+    CHECK_NO_ALLOCATION(walk(view::c_str(cstr)));
+    CHECK_NO_ALLOCATION(walk(v | view::chunk(5)));
+    CHECK_NO_ALLOCATION(walk(view::concat(v, w)));
+    CHECK_NO_ALLOCATION(walk(v | view::const_));
+    CHECK_NO_ALLOCATION(walk(view::counted(v.begin(), 4)));
+    CHECK_NO_ALLOCATION(walk(v | view::cycle | view::take(30)));
+    CHECK_NO_ALLOCATION(walk(view::delimit(v, 13)));
+    CHECK_NO_ALLOCATION(walk(v | view::drop(3)));
+    CHECK_NO_ALLOCATION(walk(v | view::drop_exactly(3)));
+    CHECK_NO_ALLOCATION(walk(v | view::drop_while(is_odd{})));
+    CHECK_NO_ALLOCATION(walk(view::empty<int>()));
+    CHECK_NO_ALLOCATION(walk(v | view::filter(is_odd{})));
+    CHECK_NO_ALLOCATION(walk(v | view::for_each([](int i) { return yield_if(i % 2 == 0, i); })));
+    CHECK_NO_ALLOCATION(walk(view::generate([&n] { return ++n; }) | view::take(10)));
+    CHECK_NO_ALLOCATION(walk(view::generate_n([&n] { return ++n; }, 10)));
+    CHECK_NO_ALLOCATION(walk(v | view::group_by(std::equal_to<int>{})));
+    CHECK_NO_ALLOCATION(walk(ptrs | view::indirect));
+    CHECK_NO_ALLOCATION(walk(v | view::intersperse(0)));
+    CHECK_NO_ALLOCATION(walk(view::ints(0, 100)));
+    CHECK_NO_ALLOCATION(walk(v | view::chunk(3) | view::join));
+    CHECK_NO_ALLOCATION(walk(view::iota(0, 10)
+        | view::transform([](int i) { return view::iota(0, i); })
+        | view::join));
+    CHECK_NO_ALLOCATION(walk(text | view::lines_reverse));
+    CHECK_NO_ALLOCATION(walk(kv | view::keys));
+    CHECK_NO_ALLOCATION(walk(kv | view::values));
+    CHECK_NO_ALLOCATION(walk(v | view::move));
+    CHECK_NO_ALLOCATION(walk(v | view::partial_sum()));
+    CHECK_NO_ALLOCATION(walk(v | view::remove_if(is_odd{})));
+    CHECK_NO_ALLOCATION(walk(view::repeat(7) | view::take(10)));
+    CHECK_NO_ALLOCATION(walk(view::repeat_n(7, 10)));
+    CHECK_NO_ALLOCATION(walk(v | view::replace(8, 0)));
+    CHECK_NO_ALLOCATION(walk(v | view::replace_if(is_odd{}, 0)));
+    CHECK_NO_ALLOCATION(walk(v | view::reverse));
+    CHECK_NO_ALLOCATION(walk(v | view::rle_encode));
+    CHECK_NO_ALLOCATION(walk(v | view::sample(5, gen)));
+    CHECK_NO_ALLOCATION(walk(view::set_difference(v, w)));
+    CHECK_NO_ALLOCATION(walk(view::set_intersection(v, w)));
+    CHECK_NO_ALLOCATION(walk(view::set_union(v, w)));
+    CHECK_NO_ALLOCATION(walk(view::set_symmetric_difference(v, w)));
+    CHECK_NO_ALLOCATION(walk(view::single(42)));
+    CHECK_NO_ALLOCATION(walk(v | view::slice(2, 7)));
+    CHECK_NO_ALLOCATION(walk(v | view::sliding(3)));
+    CHECK_NO_ALLOCATION(walk(v | view::split(8)));
+    CHECK_NO_ALLOCATION(walk(v | view::stride(3)));
+    CHECK_NO_ALLOCATION(walk(v | view::tail));
+    CHECK_NO_ALLOCATION(walk(v | view::take(5)));
+    CHECK_NO_ALLOCATION(walk(v | view::take_exactly(5)));
+    CHECK_NO_ALLOCATION(walk(v | view::take_while(is_odd{})));
+    CHECK_NO_ALLOCATION(walk(view::rows(matrix, 6)));
+    CHECK_NO_ALLOCATION(walk(view::cols(matrix, 6)));
+    CHECK_NO_ALLOCATION(walk(view::tile2d(matrix, 6, 2, 3)));
+    CHECK_NO_ALLOCATION(walk(v | view::transform(twice{})));
+    CHECK_NO_ALLOCATION(auto u = view::unbounded(v.data()); (void)*next(ranges::begin(u), 5));
+    CHECK_NO_ALLOCATION(walk(v | view::unique));
+    CHECK_NO_ALLOCATION(walk(view::zip(v, w)));
+    CHECK_NO_ALLOCATION(walk(view::zip_with(std::plus<int>{}, v, w)));
+
+    // Views that own state allocate it when they are built, but not while
+    // they are iterated.
+    {
+        std::vector<std::string> pats = {"one", "e\nt"};
+        auto rng = view::find_all(text, pats);
+        CHECK_NO_ALLOCATION(walk(rng));
+    }
+    {
+        auto rng = runs | view::rle_decode;
+        CHECK_NO_ALLOCATION(walk(rng));
+    }
+
+    // view::tokenize is not covered: iterating std::regex_token_iterator
+    // allocates match results.
+}
+
+void test_allocating_views()
+{
+    std::vector<int> v = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    // One allocation for the erased view, and one for each iterator.
+    CHECK_ALLOCATIONS_AT_MOST(3, walk(any_view<int>{v}));
+    CHECK_ALLOCATIONS_AT_MOST(3, walk(any_input_view<int>{v}));
+
+    // A small sample of a random-access range shares its positions between
+    // copies of the iterator.
+    std::vector<int> const w = view::iota(0, 1000);
+    std::mt19937 gen;
+    CHECK_ALLOCATIONS_AT_MOST(3, walk(w | view::sample(10, gen)));
+}
+
+void test_algorithms()
+{
+    std::vector<int> v(1000), out(2000);
+    std::vector<int> const w = view::iota(0, 1000) | view::transform(twice{});
+    std::vector<std::size_t> bins(16);
+    std::mt19937 gen;
+    auto reset = [&] { for(std::size_t i = 0; i < v.size(); ++i) v[i] = int((i * 7919) % 1000); };
+    reset();
+
+    CHECK_NO_ALLOCATION(sort(v));
+    reset();
+    CHECK_NO_ALLOCATION(partial_sort(v, v.begin() + 100));
+    reset();
+    CHECK_NO_ALLOCATION(nth_element(v, v.begin() + 500));
+    reset();
+    CHECK_NO_ALLOCATION(make_heap(v); sort_heap(v));
+    CHECK_NO_ALLOCATION(partition(v, is_odd{}));
+    CHECK_NO_ALLOCATION(rotate(v, v.begin() + 300));
+    CHECK_NO_ALLOCATION(reverse(v));
+    CHECK_NO_ALLOCATION(shuffle(v, gen));
+    CHECK_NO_ALLOCATION(next_permutation(v));
+    CHECK_NO_ALLOCATION(is_permutation(v, v));
+    CHECK_NO_ALLOCATION(sort(v); unique(v));
+    reset();
+    CHECK_NO_ALLOCATION(remove_if(v, is_odd{}));
+    CHECK_NO_ALLOCATION(find(w, 500); find_if(w, is_odd{}); count(w, 4); count_if(w, is_odd{}));
+    CHECK_NO_ALLOCATION(search(w, view::iota(100, 110)); search_n(w, 3, 0));
+    CHECK_NO_ALLOCATION(find_end(w, view::iota(100, 110)); find_first_of(w, view::iota(7, 9)));
+    CHECK_NO_ALLOCATION(find_first_of(w, view::iota(7, 17)); find_first_of(w, view::iota(7, 107)));
+    CHECK_NO_ALLOCATION(equal(w, w); mismatch(w, w); lexicographical_compare(w, w));
+    CHECK_NO_ALLOCATION(adjacent_find(w); is_sorted(w); min_element(w); minmax_element(w));
+    CHECK_NO_ALLOCATION(lower_bound(w, 500); upper_bound(w, 500); equal_range(w, 500);
+        binary_search(w, 500));
+    CHECK_NO_ALLOCATION(merge(w, w, out.begin()));
+    CHECK_NO_ALLOCATION(set_union(w, w, out.begin()); set_difference(w, v, out.begin()));
+    CHECK_NO_ALLOCATION(copy(w, v.begin()); copy_if(w, out.begin(), is_odd{});
+        copy_backward(w, v.end()));
+    CHECK_NO_ALLOCATION(transform(w, v.begin(), twice{}); fill(v, 3); generate(v, gen));
+    CHECK_NO_ALLOCATION(replace(v, 3, 4); swap_ranges(v, out));
+    CHECK_NO_ALLOCATION(sample(w, out.begin(), 200, gen));
+    CHECK_NO_ALLOCATION(transpose(w, v, 40, 25));
+    CHECK_NO_ALLOCATION(accumulate(w, 0); accumulate(reproducible, w, 0);
+        inner_product(w, w, 0); partial_sum(w, out.begin()); adjacent_difference(w, out.begin());
+        iota(v, 0));
+    CHECK_NO_ALLOCATION(for_each_resumable(v, [](int &i) { ++i; }).resume(work_budget::unlimited()));
+
+    // The stable algorithms and the resumable sort need one buffer each.
+    reset();
+    CHECK_ALLOCATIONS_AT_MOST(1, stable_sort(v));
+    CHECK_ALLOCATIONS_AT_MOST(1, stable_partition(v, is_odd{}));
+    reset();
+    sort(v.begin(), v.begin() + 500);
+    sort(v.begin() + 500, v.end());
+    CHECK_ALLOCATIONS_AT_MOST(1, inplace_merge(v, v.begin() + 500));
+    reset();
+    CHECK_ALLOCATIONS_AT_MOST(1, sort_resumable(v).resume(work_budget::unlimited()));
+    CHECK(is_sorted(v));
+
+    // A small sample of a random-access range keeps its positions in a hash
+    // set and a vector.
+    CHECK_ALLOCATIONS_AT_MOST(2, sample(w, out.begin(), 100, gen));
+
+    // The sequential histogram counts into a scratch array, and into private
+    // copies of it when there are few bins.
+    CHECK_ALLOCATIONS_AT_MOST(2, histogram(w | view::transform([](int i) { return i % 16; }),
+        bins));
+}
+
+int main()
+{
+    test_views();
+    test_allocating_views();
+    test_algorithms();
+
+    return ::test_result();
+}
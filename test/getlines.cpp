@@ -17,6 +17,26 @@
 
 using namespace ranges;
 
+namespace
+{
+    // A string buffer whose reads fail before offset `fail_before`.
+    struct failing_buf
+      : std::stringbuf
+    {
+        std::ptrdiff_t fail_before;
+        failing_buf(std::string const &str, std::ptrdiff_t n)
+          : std::stringbuf{str}, fail_before(n)
+        {}
+    protected:
+        std::streamsize xsgetn(char *s, std::streamsize n) override
+        {
+            if(gptr() - eback() < fail_before)
+                return 0;
+            return std::stringbuf::xsgetn(s, n);
+        }
+    };
+}
+
 int main()
 {
     const char* text =
@@ -34,5 +54,37 @@ good men
     CONCEPT_ASSERT(!ForwardView<Rng>());
     CONCEPT_ASSERT(Same<range_rvalue_reference_t<Rng>, std::string &&>());
 
+    std::stringstream rin{text};
+    ::check_equal(getlines_reverse(rin), {"good men", "for all", "the time", "Now is"});
+
+    using RRng = decltype(getlines_reverse(rin));
+    CONCEPT_ASSERT(InputView<RRng>());
+    CONCEPT_ASSERT(!ForwardView<RRng>());
+
+    // Lines that span several blocks, empty lines, and no trailing newline.
+    for(std::size_t block : {1u, 2u, 3u, 64u})
+    {
+        std::stringstream s1{"\nfirst\n\na much longer line\nlast"};
+        ::check_equal(getlines_reverse(s1, '\n', block),
+            {"last", "a much longer line", "", "first", ""});
+        std::stringstream s2{"a;bb;;"};
+        ::check_equal(getlines_reverse(s2, ';', block), {"", "bb", "a"});
+    }
+    std::stringstream empty{""};
+    CHECK(distance(getlines_reverse(empty)) == 0);
+    std::stringstream newline{"\n"};
+    ::check_equal(getlines_reverse(newline), {""});
+
+    // A long line read a byte at a time.
+    std::string const longline(10000, 'x');
+    std::stringstream s3{"a\n" + longline + "\nb"};
+    ::check_equal(getlines_reverse(s3, '\n', 1), {std::string{"b"}, longline, std::string{"a"}});
+
+    // A read error ends the range without a partial line and fails the stream.
+    failing_buf fb{"aa\nbb\ncc\n", 3};
+    std::istream fin{&fb};
+    ::check_equal(getlines_reverse(fin, '\n', 2), {"cc"});
+    CHECK(fin.fail());
+
     return ::test_result();
 }
@@ -0,0 +1,108 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstdint>
+#include <list>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/hash.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+struct Unhashable {};
+
+int main()
+{
+    using namespace ranges;
+
+    CONCEPT_ASSERT(Hasher<hasher, int>());
+    CONCEPT_ASSERT(Hasher<hasher, std::string>());
+    CONCEPT_ASSERT(Hasher<hasher, std::vector<std::pair<int, std::string>>>());
+    CONCEPT_ASSERT(!Hasher<hasher, Unhashable>());
+
+    // Streaming gives the same result as hashing in one piece, at every
+    // length and however the input is split.
+    {
+        std::vector<unsigned char> bytes;
+        for(int i = 0; i < 300; ++i)
+            bytes.push_back(static_cast<unsigned char>(i * 37 + 11));
+        bool ok = true;
+        for(std::size_t len = 0; len <= bytes.size(); ++len)
+        {
+            std::uint64_t const whole = detail::hash_bytes(bytes.data(), len);
+            for(std::size_t piece : {1u, 7u, 16u, 48u, 95u})
+            {
+                hash_combiner h;
+                for(std::size_t i = 0; i < len; i += piece)
+                    h.update(bytes.data() + i, piece < len - i ? piece : len - i);
+                ok = ok && h.result() == whole;
+            }
+        }
+        CHECK(ok);
+    }
+
+    // Equal sequences hash equal whatever holds them.
+    {
+        std::vector<int> vi{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+        std::list<int> li(vi.begin(), vi.end());
+        CHECK(hash_range(vi) == hash_range(li));
+        CHECK(hash_range(vi) == hash_range(view::iota(1, 14)));
+        CHECK(hash_range(vi) != hash_range(view::iota(1, 13)));
+        CHECK(hash_range(std::string("hello")) == hash_range(std::list<char>{'h','e','l','l','o'}));
+        CHECK(hash_range(std::string("hello")) != hash_range(std::string("hellp")));
+        CHECK(hash_range(std::string{}) == hash_range(std::vector<char>{}));
+    }
+
+    // Scalars mix well: consecutive integers land in distinct low-bit buckets
+    // about as often as random values would.
+    {
+        std::set<std::uint64_t> low;
+        for(int i = 0; i < 1000; ++i)
+            low.insert(hasher{}(i) & 0xffff);
+        CHECK(low.size() > 980u);
+        CHECK(hasher{}(0.0) == hasher{}(-0.0));
+        CHECK(hasher{}(1.0) != hasher{}(-1.0));
+    }
+
+    // Structured elements
+    {
+        std::vector<std::string> vs{"This", "is", "his", "face"};
+        std::list<std::string> ls(vs.begin(), vs.end());
+        CHECK(hash_range(vs) == hash_range(ls));
+        CHECK(hasher{}(vs) == hash_range(vs));
+        CHECK(hasher{}(std::make_pair(1, std::string("a"))) ==
+            hasher{}(std::make_pair(1, std::string("a"))));
+        CHECK(hasher{}(std::make_pair(1, 2)) != hasher{}(std::make_pair(2, 1)));
+        CHECK(hasher{}(std::make_tuple(1, 2, 3)) != hasher{}(std::make_tuple(3, 2, 1)));
+
+        // A user-supplied element hasher
+        auto by_size = [](std::string const &s) { return s.size(); };
+        CHECK(hash_range(vs, by_size) == hash_range(std::vector<std::string>{"abcd", "ab", "abc", "abcd"}, by_size));
+
+        // Usable in hashed containers and as a projection
+        std::unordered_set<std::string, hasher> set(vs.begin(), vs.end());
+        CHECK(set.size() == 4u);
+        CHECK(set.count("his") == 1u);
+        sort(vs, less{}, hash_range);
+        CHECK(is_sorted(vs, less{}, hash_range));
+    }
+
+    return ::test_result();
+}
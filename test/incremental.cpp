@@ -0,0 +1,87 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/incremental.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    auto even = [](int i) { return i % 2 == 0; };
+
+    {
+        std::vector<int> src = {1, 2, 3, 4};
+        auto inc = incremental(src, stage::filter(even), stage::partial_sum());
+        CONCEPT_ASSERT(Same<decltype(inc)::value_type, int>());
+        CONCEPT_ASSERT(RandomAccessRange<decltype(inc) const>());
+        ::check_equal(inc, {2, 6});
+        CHECK(inc.consumed() == 4u);
+
+        CHECK(inc.refresh() == 0u);
+        src.push_back(5);
+        CHECK(inc.refresh() == 0u);
+        src.push_back(6);
+        src.push_back(8);
+        CHECK(inc.refresh() == 2u);
+        ::check_equal(inc, {2, 6, 12, 20});
+        CHECK(inc.consumed() == src.size());
+
+        // Only the new elements go through the stages.
+        int calls = 0;
+        auto counting = [&](int i) { ++calls; return i; };
+        auto inc2 = incremental(src, stage::transform(counting));
+        CHECK(calls == 7);
+        src.push_back(10);
+        inc2.refresh();
+        CHECK(calls == 8);
+    }
+
+    // Transform changes the element type.
+    {
+        std::vector<int> src = {1, 2};
+        auto inc = incremental(src, stage::transform([](int i) { return std::to_string(i); }));
+        CONCEPT_ASSERT(Same<decltype(inc)::value_type, std::string>());
+        src.push_back(30);
+        inc.refresh();
+        ::check_equal(inc.output(), {std::string("1"), std::string("2"), std::string("30")});
+    }
+
+    // Running group aggregates; the open group is kept across refreshes.
+    {
+        using P = std::pair<char, int>;
+        std::vector<P> src = {{'a', 1}, {'a', 2}, {'b', 3}};
+        auto same_key = [](P const &x, P const &y) { return x.first == y.first; };
+        auto add = [](int acc, P const &p) { return acc + p.second; };
+        auto inc = incremental(src, stage::group_by(same_key, 0, add));
+        ::check_equal(inc, {3});
+        src.push_back({'b', 4});
+        CHECK(inc.refresh() == 0u);
+        src.push_back({'c', 5});
+        CHECK(inc.refresh() == 1u);
+        ::check_equal(inc, {3, 7});
+        src.push_back({'a', 6});
+        inc.refresh();
+        ::check_equal(inc, {3, 7, 5});
+
+        // Rebuilding after an in-place edit starts over.
+        src[0].second = 10;
+        inc.rebuild();
+        ::check_equal(inc, {12, 7, 5});
+    }
+
+    return ::test_result();
+}
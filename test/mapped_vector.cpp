@@ -0,0 +1,127 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <system_error>
+#include <unistd.h>
+#include <range/v3/core.hpp>
+#include <range/v3/mapped_vector.hpp>
+#include <range/v3/action/push_back.hpp>
+#include <range/v3/action/sort.hpp>
+#include <range/v3/action/unique.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/view/drop.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+using namespace ranges;
+
+int main()
+{
+    CONCEPT_ASSERT(Container<mapped_vector<int>>());
+    CONCEPT_ASSERT(RandomAccessReservable<mapped_vector<int>>());
+    CONCEPT_ASSERT(ContiguousRange<mapped_vector<int>>());
+
+    auto sq = [](int i) { return i * i; };
+
+    // As the target of to_, in anonymous shared memory.
+    {
+        auto v = view::iota(0, 5000) | view::transform(sq) | to_<mapped_vector<int>>();
+        CHECK(v.size() == 5000u);
+        CHECK(equal(v, view::iota(0, 5000) | view::transform(sq)));
+        CHECK(v.native_handle() != -1);
+        auto w = std::move(v);
+        CHECK(w.size() == 5000u);
+        CHECK(v.empty());
+    }
+
+    // Vector members, and actions.
+    {
+        mapped_vector<int> v{5, 3, 5, 1, 3};
+        v = std::move(v) | action::sort | action::unique;
+        ::check_equal(v, {1, 3, 5});
+        v.insert(v.begin() + 1, 2);
+        v.insert(v.end(), {6, 7});
+        ::check_equal(v, {1, 2, 3, 5, 6, 7});
+        v.erase(v.begin() + 3);
+        v.erase(v.begin(), v.begin() + 2);
+        ::check_equal(v, {3, 6, 7});
+        v.insert(v.begin(), v.begin(), v.end());
+        ::check_equal(v, {3, 6, 7, 3, 6, 7});
+        v.insert(v.begin() + 1, v.begin(), v.begin() + 2);
+        ::check_equal(v, {3, 3, 6, 6, 7, 3, 6, 7});
+        v.erase(v.begin() + 1, v.begin() + 3);
+        v.resize(8, 9);
+        v.pop_back();
+        CHECK(v.emplace_back(4) == 4);
+        ::check_equal(v, {3, 6, 7, 3, 6, 7, 9, 4});
+        v.clear();
+        CHECK(v.empty());
+        v.reserve(10000);
+        CHECK(v.capacity() >= 10000u);
+    }
+
+    // Inserting a vector's own elements while it grows.
+    {
+        mapped_vector<int> v;
+        for(int i = 0; i < 5000; ++i)
+            v.push_back(i);
+        v.insert(v.end(), v.begin(), v.end());
+        CHECK(v.size() == 10000u);
+        CHECK(equal(view::take(v, 5000), view::iota(0, 5000)));
+        CHECK(equal(view::drop(v, 5000), view::iota(0, 5000)));
+    }
+
+    // Named storage is shared with everyone who opens it.
+    auto const suffix = std::to_string(::getpid());
+    auto const file = "/tmp/range-v3.mapped_vector." + suffix;
+    auto const shm = "/range-v3.mapped_vector." + suffix;
+    for(auto kind : {mapped_kind::file, mapped_kind::shared_memory})
+    {
+        auto const &name = kind == mapped_kind::file ? file : shm;
+        {
+            mapped_vector<int> out{kind, name};
+            action::push_back(out, view::iota(0, 100) | view::transform(sq));
+            mapped_vector<int> in{kind, name, mapped_mode::open};
+            CHECK(equal(in, out));
+            in[0] = -1;
+            CHECK(out[0] == -1);
+
+            action::push_back(out, view::iota(100, 5000) | view::transform(sq));
+            CHECK(in.size() == 100u);
+            in.refresh();
+            CHECK(in.size() == 5000u);
+            CHECK(in.back() == 4999 * 4999);
+            out.sync();
+        }
+        {
+            mapped_vector<int> in{kind, name, mapped_mode::open};
+            CHECK(in.size() == 5000u);
+            CHECK(in[1] == 1);
+            bool threw = false;
+            try
+            {
+                mapped_vector<double> wrong{kind, name, mapped_mode::open};
+            }
+            catch(std::system_error const &)
+            {
+                threw = true;
+            }
+            CHECK(threw);
+        }
+        mapped_vector<int>::remove(kind, name);
+    }
+
+    return ::test_result();
+}
@@ -19,8 +19,14 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <array>
+#include <cmath>
+#include <vector>
 #include <range/v3/core.hpp>
+#include <range/v3/span.hpp>
 #include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/numeric/iota.hpp>
+#include <range/v3/utility/aligned_allocator.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -33,6 +39,28 @@ struct S
     }
 };
 
+// Not default constructible.
+struct Total
+{
+    int value;
+    explicit Total(int v)
+      : value(v)
+    {}
+    Total &operator=(int v)
+    {
+        value = v;
+        return *this;
+    }
+    friend Total operator+(Total a, Total b)
+    {
+        return Total{a.value + b.value};
+    }
+    friend Total operator+(Total a, int b)
+    {
+        return Total{a.value + b};
+    }
+};
+
 template <class Iter, class Sent = Iter>
 void test()
 {
@@ -58,6 +86,95 @@ void test()
     CHECK(ranges::accumulate(make_iterator_range(Iter(ia), Sent(ia+sc)), 10) == 31);
 }
 
+template <class Iter, class Sent = Iter, class Mode>
+void test_reassociate(Mode mode)
+{
+    int ia[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
+    constexpr unsigned sc = ranges::size(ia);
+    for(unsigned n = 0; n <= sc; ++n)
+    {
+        CHECK(ranges::accumulate(mode, Iter(ia), Sent(ia+n), 0) == int(n * (n + 1) / 2));
+        CHECK(ranges::accumulate(mode, Iter(ia), Sent(ia+n), 10) == int(10 + n * (n + 1) / 2));
+        CHECK(ranges::accumulate(mode, ranges::make_iterator_range(Iter(ia), Sent(ia+n)), 0) ==
+            int(n * (n + 1) / 2));
+    }
+}
+
+template <class Mode>
+void test_reassociate_all(Mode mode)
+{
+    test_reassociate<input_iterator<const int*> >(mode);
+    test_reassociate<forward_iterator<const int*> >(mode);
+    test_reassociate<random_access_iterator<const int*> >(mode);
+    test_reassociate<const int*>(mode);
+    test_reassociate<input_iterator<const int*>, sentinel<const int*> >(mode);
+    test_reassociate<random_access_iterator<const int*>, sentinel<const int*> >(mode);
+
+    CHECK(ranges::accumulate(mode, {1, 2, 3, 4, 5, 6}, 10) == 31);
+    CHECK(ranges::accumulate(mode, {S{1}, S{2}, S{3}, S{4}, S{5}, S{6}}, 10, ranges::plus{}, &S::i) == 31);
+
+    std::vector<int> ones(1000, 1);
+    CHECK(ranges::accumulate(mode, ones, Total{10}).value == 1010);
+}
+
+void test_floating_point()
+{
+    // Summing many small values: the sequential sum's error grows linearly,
+    // the pairwise sum's logarithmically.
+    std::vector<float> v(1 << 22, 0.1f);
+    double const exact = double(v.size()) * double(0.1f);
+    double const seq = ranges::accumulate(v, 0.0f);
+    double const pair = ranges::accumulate(ranges::pairwise, v, 0.0f);
+    double const repr = ranges::accumulate(ranges::reproducible, v, 0.0f);
+    CHECK((std::abs(seq - exact) / exact) > 1e-2);
+    CHECK((std::abs(pair - exact) / exact) < 1e-6);
+    CHECK((std::abs(repr - exact) / exact) < 1e-6);
+
+    // The reproducible result does not depend on the iterator category, even
+    // though only sized iterators take the vectorizable path.
+    std::vector<double> d(100003);
+    for(std::size_t i = 0; i < d.size(); ++i)
+        d[i] = 1.0 / double(i + 1);
+    double const r1 = ranges::accumulate(ranges::reproducible, d, 0.0);
+    double const r2 = ranges::accumulate(ranges::reproducible,
+        input_iterator<const double*>(d.data()), sentinel<const double*>(d.data() + d.size()), 0.0);
+    CHECK(r1 == r2);
+    double const u = ranges::accumulate(ranges::unseq, d, 0.0);
+    double const s = ranges::accumulate(d, 0.0);
+    CHECK(std::abs(u - s) < 1e-9);
+}
+
+void test_static_extent()
+{
+    // Small static extents take a fully unrolled kernel that associates the
+    // terms as the dynamic kernel does.
+    std::vector<double> d(300);
+    for(std::size_t i = 0; i < d.size(); ++i)
+        d[i] = 1.0 / double(i + 1);
+    auto const dyn = ranges::span<double const>{d};
+    CHECK(ranges::accumulate(ranges::reproducible, ranges::span<double const, 0>{d.data(), 0},
+        1.0) == 1.0);
+    CHECK(ranges::accumulate(ranges::reproducible, ranges::span<double const, 5>{d.data(), 5},
+        0.0) == ranges::accumulate(ranges::reproducible, dyn.first(5), 0.0));
+    CHECK(ranges::accumulate(ranges::reproducible, ranges::span<double const, 8>{d.data(), 8},
+        0.0) == ranges::accumulate(ranges::reproducible, dyn.first(8), 0.0));
+    CHECK(ranges::accumulate(ranges::unseq, ranges::span<double const, 77>{d.data(), 77},
+        0.0) == ranges::accumulate(ranges::unseq, dyn.first(77), 0.0));
+    CHECK(ranges::accumulate(ranges::pairwise, ranges::span<double const, 256>{d.data(), 256},
+        0.0) == ranges::accumulate(ranges::pairwise, dyn.first(256), 0.0));
+    CHECK(ranges::accumulate(ranges::pairwise, ranges::span<double const, 300>{d.data(), 300},
+        0.0) == ranges::accumulate(ranges::pairwise, dyn, 0.0));
+
+    std::array<int, 20> a;
+    ranges::iota(a, 1);
+    CHECK(ranges::accumulate(ranges::unseq, a, 0, ranges::plus{}, [](int i) { return 2 * i; })
+        == 420);
+
+    std::vector<float, ranges::aligned_allocator<float, 32>> v(64, 0.5f);
+    ranges::aligned_span<float const, 32, 64> s{v};
+    CHECK(ranges::accumulate(ranges::unseq, s, 0.0f) == 32.0f);
+}
+
 int main()
 {
     test<input_iterator<const int*> >();
@@ -75,5 +192,11 @@ int main()
     CHECK(ranges::accumulate({1, 2, 3, 4, 5, 6}, S{10}, &S::add).i == 31);
     CHECK(ranges::accumulate({S{1}, S{2}, S{3}, S{4}, S{5}, S{6}}, 10, ranges::plus{}, &S::i) == 31);
 
+    test_reassociate_all(ranges::unseq);
+    test_reassociate_all(ranges::pairwise);
+    test_reassociate_all(ranges::reproducible);
+    test_floating_point();
+    test_static_extent();
+
     return ::test_result();
 }
@@ -22,7 +22,10 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <cmath>
+#include <vector>
 #include <range/v3/core.hpp>
+#include <range/v3/span.hpp>
 #include <range/v3/numeric/inner_product.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include "../simple_test.hpp"
@@ -37,6 +40,28 @@ namespace
       int i;
   };
 
+  // Not default constructible.
+  struct Total
+  {
+      int value;
+      explicit Total(int v)
+        : value(v)
+      {}
+      Total &operator=(int v)
+      {
+          value = v;
+          return *this;
+      }
+      friend Total operator+(Total a, Total b)
+      {
+          return Total{a.value + b.value};
+      }
+      friend Total operator+(Total a, int b)
+      {
+          return Total{a.value + b};
+      }
+  };
+
   template <class Iter1, class Iter2, class Sent1 = Iter1>
   void test()
   {
@@ -117,6 +142,80 @@ namespace
   }
 }
 
+namespace
+{
+  template <class Iter1, class Iter2, class Mode>
+  void test_reassociate(Mode mode)
+  {
+      int a[20], b[20];
+      for(int i = 0; i < 20; ++i)
+      {
+          a[i] = i + 1;
+          b[i] = 20 - i;
+      }
+      for(int n = 0; n <= 20; ++n)
+      {
+          int expected = 0;
+          for(int i = 0; i < n; ++i)
+              expected += a[i] * b[i];
+          CHECK(ranges::inner_product(mode, Iter1(a), Iter1(a+n), Iter2(b), 0) == expected);
+          CHECK(ranges::inner_product(mode, Iter1(a), Iter1(a+n), Iter2(b), Iter2(b+n), 10) ==
+              expected + 10);
+          CHECK(ranges::inner_product(mode, ranges::make_iterator_range(Iter1(a), Iter1(a+n)),
+              ranges::make_iterator_range(Iter2(b), Iter2(b+20)), 0) == expected);
+      }
+      // The shorter range determines the length.
+      CHECK(ranges::inner_product(mode, Iter1(a), Iter1(a+20), Iter2(b), Iter2(b+1), 0) == 20);
+      CHECK(ranges::inner_product(mode, Iter1(a), Iter1(a+1), Iter2(b), Iter2(b+20), 0) == 20);
+  }
+
+  template <class Mode>
+  void test_reassociate_all(Mode mode)
+  {
+      test_reassociate<input_iterator<const int*>, input_iterator<const int*> >(mode);
+      test_reassociate<forward_iterator<const int*>, const int*>(mode);
+      test_reassociate<const int*, random_access_iterator<const int*> >(mode);
+      test_reassociate<const int*, const int*>(mode);
+
+      S s[] = {{1}, {2}, {3}};
+      int b[] = {4, 5, 6};
+      CHECK(ranges::inner_product(mode, s, b, 0, ranges::plus{}, ranges::multiplies{}, &S::i) == 32);
+
+      std::vector<int> ones(1000, 1), twos(1000, 2);
+      CHECK(ranges::inner_product(mode, ones, twos, Total{10}).value == 2010);
+  }
+
+  void test_floating_point()
+  {
+      std::vector<double> a(10007), b(10007);
+      for(std::size_t i = 0; i < a.size(); ++i)
+      {
+          a[i] = 1.0 / double(i + 1);
+          b[i] = double(i % 7) - 3.0;
+      }
+      double const s = ranges::inner_product(a, b, 0.0);
+      double const u = ranges::inner_product(ranges::unseq, a, b, 0.0);
+      double const p = ranges::inner_product(ranges::pairwise, a, b, 0.0);
+      double const r1 = ranges::inner_product(ranges::reproducible, a, b, 0.0);
+      double const r2 = ranges::inner_product(ranges::reproducible,
+          input_iterator<const double*>(a.data()), input_iterator<const double*>(a.data() + a.size()),
+          b.data(), 0.0);
+      CHECK(std::abs(u - s) < 1e-9);
+      CHECK(std::abs(p - s) < 1e-9);
+      CHECK(std::abs(r1 - s) < 1e-9);
+      CHECK(r1 == r2);
+
+      // Both extents static: the unrolled kernel, with the shorter length.
+      ranges::span<double const, 40> sa{a.data(), 40};
+      ranges::span<double const, 50> sb{b.data(), 50};
+      ranges::span<double const> da{a.data(), 40}, db{b.data(), 40};
+      CHECK(ranges::inner_product(ranges::reproducible, sa, sb, 0.0) ==
+          ranges::inner_product(ranges::reproducible, da, db, 0.0));
+      CHECK(ranges::inner_product(ranges::unseq, sa, sb, 0.0) ==
+          ranges::inner_product(ranges::unseq, da, db, 0.0));
+  }
+}
+
 int main()
 {
     test<input_iterator<const int*>, input_iterator<const int*> >();
@@ -190,5 +289,10 @@ int main()
         CHECK(ranges::inner_product(a, b, 10) == 66);
     }
 
+    test_reassociate_all(ranges::unseq);
+    test_reassociate_all(ranges::pairwise);
+    test_reassociate_all(ranges::reproducible);
+    test_floating_point();
+
     return ::test_result();
 }
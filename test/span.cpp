@@ -26,6 +26,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <range/v3/span.hpp>
+#include <range/v3/to_container.hpp>
+#include <range/v3/utility/aligned_allocator.hpp>
+#include <range/v3/view/iota.hpp>
 #include "./simple_test.hpp"
 #include "./test_utils.hpp"
 
@@ -958,6 +961,42 @@ namespace
     }
 }
 
+void test_aligned_span()
+{
+    using V = std::vector<float, aligned_allocator<float, 64>>;
+    V v = view::iota(0, 100) | to_<V>();
+    CHECK((reinterpret_cast<std::uintptr_t>(v.data()) % 64) == 0u);
+    {
+        // Over-aligned blocks of any size, large ones included.
+        aligned_allocator<double, 4096> a;
+        double *const p = a.allocate(1 << 19);
+        CHECK((reinterpret_cast<std::uintptr_t>(p) % 4096) == 0u);
+        a.deallocate(p, 1 << 19);
+    }
+
+    aligned_span<float, 64> s{v};
+    CONCEPT_ASSERT(View<aligned_span<float, 64>>());
+    CONCEPT_ASSERT(ContiguousRange<aligned_span<float, 64>>());
+    CONCEPT_ASSERT(range_cardinality<aligned_span<float, 64, 16>>::value == 16);
+    CONCEPT_ASSERT(aligned_span<float, 64>::alignment == 64u);
+    CHECK(s.data() == v.data());
+    CHECK(s.size() == 100);
+    CHECK(ranges::begin(s) == v.data());
+    CHECK(ranges::end(s) == v.data() + 100);
+
+    aligned_span<float, 64, 16> f = s.first<16>();
+    CHECK(f.data() == v.data());
+    CHECK(f[15] == 15.0f);
+    aligned_span<float, 64> d = s.first(32);
+    CHECK(d.size() == 32);
+    span<float const> c = s;
+    CHECK(c.data() == v.data());
+    CHECK(c.size() == 100);
+
+    aligned_span<float, 64> e{};
+    CHECK(e.empty());
+}
+
 int main()
 {
     {
@@ -1017,6 +1056,7 @@ int main()
     test_fixed_size_conversions();
     test_as_writeable_bytes();
     test_iterator();
+    test_aligned_span();
 
     return ::test_result();
 }
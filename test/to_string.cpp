@@ -0,0 +1,69 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/to_string.hpp>
+#include <range/v3/view/c_str.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/split.hpp>
+#include <range/v3/view/transform.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<std::string> vs{"This","is","his","face"};
+
+    auto str0 = to_string(vs[0]);
+    static_assert((bool)Same<decltype(str0), std::string>(), "");
+    CHECK(str0 == "This");
+
+    std::list<char> lc{'f','a','c','e'};
+    CHECK(to_string(lc) == "face");
+    CHECK((view::c_str("his") | to_string) == "his");
+
+    // Joined contiguous pieces are assembled in a single allocation
+    auto str1 = view::join(vs) | to_string;
+    CHECK(str1 == "Thisishisface");
+    CHECK(str1.capacity() >= 13u);
+
+    auto str2 = to_string(view::join(vs, ' '));
+    CHECK(str2 == "This is his face");
+    CHECK(str2.capacity() >= 16u);
+
+    std::string sep = ", ";
+    CHECK(to_string(view::join(vs, sep)) == "This, is, his, face");
+
+    std::vector<std::string> none;
+    CHECK(to_string(view::join(none, sep)).empty());
+    CHECK(to_string(view::join(none)).empty());
+
+    // Non-contiguous and single-pass inner ranges
+    std::vector<std::list<char>> vl{{'a','b'},{},{'c'}};
+    CHECK(to_string(view::join(vl, '-')) == "ab--c");
+
+    std::string csv = "Now,is,the,time";
+    CHECK(to_string(csv | view::split(',') | view::join(' ')) == "Now is the time");
+
+    auto longer = vs | view::filter([](std::string const &s) { return s.size() > 2; });
+    CHECK(to_string(longer | view::join(' ')) == "This his face");
+
+    auto doubled = vs | view::transform([](std::string const &s){ return s + s; });
+    CHECK(to_string(view::join(doubled, '.')) == "ThisThis.isis.hishis.faceface");
+
+    return ::test_result();
+}
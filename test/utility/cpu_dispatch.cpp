@@ -0,0 +1,311 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+// CMake runs this test once for each value of RANGES_CPU_ISA, so that every
+// kernel the processor supports is checked against the portable loops.
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/copy_if.hpp>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/find.hpp>
+#include <range/v3/algorithm/find_first_of.hpp>
+#include <range/v3/algorithm/max_element.hpp>
+#include <range/v3/algorithm/min_element.hpp>
+#include <range/v3/algorithm/replace.hpp>
+#include <range/v3/algorithm/replace_if.hpp>
+#include <range/v3/algorithm/reverse.hpp>
+#include <range/v3/algorithm/search.hpp>
+#include <range/v3/algorithm/search_n.hpp>
+#include <range/v3/algorithm/swap_ranges.hpp>
+#include <range/v3/algorithm/transform.hpp>
+#include <range/v3/utility/cpu_dispatch.hpp>
+#include "../simple_test.hpp"
+
+// Disables the kernels.
+struct same
+{
+    template<typename T>
+    T operator()(T t) const
+    {
+        return t;
+    }
+};
+
+struct equal_values
+{
+    template<typename T>
+    bool operator()(T a, T b) const
+    {
+        return a == b;
+    }
+};
+
+struct less_than
+{
+    template<typename T>
+    bool operator()(T a, T b) const
+    {
+        return a < b;
+    }
+};
+
+template<typename T>
+void test_type()
+{
+    using namespace ranges;
+    using lim = std::numeric_limits<T>;
+    std::uint32_t seed = 12345;
+    for(int n = 0; n < 300; n += n < 80 ? 1 : 37)
+    {
+        std::vector<T> v(static_cast<std::size_t>(n));
+        for(int alphabet : {3, 100})
+        {
+            for(auto &t : v)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                t = static_cast<T>(static_cast<int>((seed >> 16) % static_cast<unsigned>(alphabet)));
+            }
+            // Extreme values at the ends, where lanes are easy to get wrong.
+            if(n > 40 && alphabet == 100)
+            {
+                v[static_cast<std::size_t>(n - 1)] = (lim::min)();
+                v[static_cast<std::size_t>(n - 2)] = (lim::max)();
+            }
+            T const *const b = v.data();
+            T const *const e = b + n;
+            for(T val : {T(0), T(1), T(2), T(50), T(99), (lim::min)(), (lim::max)()})
+            {
+                auto const expected = find(v, val, same{});
+                CHECK(find(v, val) == expected);
+                CHECK(find(b, e, val) == b + (expected - v.begin()));
+                auto const c = count(v, val, same{});
+                CHECK(count(v, val) == c);
+                CHECK(count(b, e, val) == c);
+                for(std::ptrdiff_t k : {1, 2, 3})
+                {
+                    auto const run = search_n(v, k, val, equal_values{});
+                    CHECK(search_n(v, k, val) == run);
+                    CHECK(search_n(b, e, k, val) == b + (run - v.begin()));
+                }
+            }
+            // Patterns taken from the text, so that they are found, and
+            // patterns that are not.
+            for(int k : {1, 3, 5})
+            {
+                for(int at : {0, n / 2, n - k})
+                {
+                    if(at < 0 || at + k > n)
+                        continue;
+                    std::vector<T> pat(v.begin() + at, v.begin() + at + k);
+                    auto const expected = search(v, pat, equal_values{});
+                    CHECK(search(v, pat) == expected);
+                    CHECK(search(b, e, pat.begin(), pat.end()) == b + (expected - v.begin()));
+                    pat.back() = (lim::max)();
+                    CHECK(search(v, pat) == search(v, pat, equal_values{}));
+                }
+            }
+            // Equal, and differing at the start, the middle and the end.
+            auto w = v;
+            CHECK(equal(v, w));
+            CHECK(equal(b, e, w.data()));
+            CHECK(equal(b, e, w.data(), w.data() + n));
+            for(int at : {0, n / 2, n - 1})
+            {
+                if(at < 0 || at >= n)
+                    continue;
+                w = v;
+                w[static_cast<std::size_t>(at)] ^= T(1);
+                CHECK(!equal(v, w));
+                CHECK(!equal(b, e, w.data()));
+                CHECK(!equal(b, e, w.data(), w.data() + n));
+            }
+            if(n > 0)
+                CHECK(!equal(v, std::vector<T>(v.begin(), v.end() - 1)));
+            auto const lo = min_element(v, less_than{});
+            CHECK(min_element(v) == lo);
+            CHECK(min_element(b, e) == b + (lo - v.begin()));
+            auto const hi = max_element(v, less_than{});
+            CHECK(max_element(v) == hi);
+            CHECK(max_element(b, e) == b + (hi - v.begin()));
+        }
+    }
+}
+
+// Sets of 0 to 40 bytes drawn from all 256 values, searched for in text
+// drawn from all 256 values.
+template<typename T>
+void test_find_first_of()
+{
+    using namespace ranges;
+    std::uint32_t seed = 54321;
+    auto const next = [&]
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<T>(static_cast<unsigned char>(seed >> 16));
+    };
+    for(int n = 0; n < 600; n += n < 80 ? 1 : 61)
+    {
+        std::vector<T> v(static_cast<std::size_t>(n));
+        for(std::size_t m : {0, 1, 2, 5, 16, 40})
+        {
+            std::vector<T> set(m);
+            for(auto &t : set)
+                t = next();
+            for(auto &t : v)
+            {
+                do
+                    t = next();
+                while(find(set, t, same{}) != set.end());
+            }
+            if(n > 0 && m > 0)
+                v[static_cast<std::size_t>(seed % static_cast<unsigned>(n))] = set[seed % m];
+            T const *const b = v.data();
+            T const *const e = b + n;
+            auto const expected = find_first_of(v, set, equal_values{});
+            CHECK(find_first_of(v, set) == expected);
+            CHECK(find_first_of(b, e, set.begin(), set.end()) == b + (expected - v.begin()));
+        }
+    }
+}
+
+// The kernels for arrays and vectors against the portable loops, which the
+// projection or the iterators select.
+template<typename T>
+void test_mutating()
+{
+    using namespace ranges;
+    auto const small = [](T t) { return t < T(3); };
+    auto const affine = [](T t) { return static_cast<T>(t * 3 + 1); };
+    auto const half = [](T t) { return t / 2.0; };
+    auto const difference = [](T a, T b) { return static_cast<T>(a - b); };
+    std::uint32_t seed = 2468;
+    for(int n = 0; n < 300; n += n < 80 ? 1 : 37)
+    {
+        std::vector<T> a(static_cast<std::size_t>(n)), b(a.size());
+        for(auto &t : a)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            t = static_cast<T>(static_cast<int>((seed >> 16) % 10u));
+        }
+        for(std::size_t i = 0; i < b.size(); ++i)
+            b[i] = static_cast<T>(static_cast<int>(i % 100));
+        T *const p = a.data(), *const q = b.data();
+
+        auto x = a, y = a;
+        CHECK(replace(x, T(7), T(42)) == x.end());
+        replace(y, T(7), T(42), same{});
+        CHECK(x == y);
+        CHECK(replace_if(x.data(), x.data() + n, small, T(9)) == x.data() + n);
+        replace_if(y, small, T(9), same{});
+        CHECK(x == y);
+
+        x = a, y = a;
+        auto const kept = copy_if(a, x.data(), small);
+        CHECK(kept.in() == a.end());
+        auto const kept2 = copy_if(a, y.begin(), small, same{});
+        CHECK((kept.out() - x.data()) == (kept2.out() - y.begin()));
+        CHECK(x == y);
+        CHECK(copy_if(static_cast<T const *>(p), p + n, x.data(), small).out() == kept.out());
+        CHECK(x == y);
+        // Compacting in place
+        x = a;
+        CHECK(copy_if(x.data(), x.data() + n, x.data(), small).out() == kept.out());
+        CHECK(x == y);
+
+        x = a, y = a;
+        CHECK(reverse(x) == x.end());
+        reverse(y.begin(), y.end());
+        CHECK(x == y);
+        CHECK(reverse(x.data(), x.data() + n) == x.data() + n);
+        CHECK(x == a);
+
+        x = a, y = b;
+        auto const s = swap_ranges(x, y);
+        CHECK(s.in1() == x.end());
+        CHECK(s.in2() == y.end());
+        CHECK(x == b);
+        CHECK(y == a);
+        CHECK(swap_ranges(x.data(), x.data() + n, y.data()).in2() == y.data() + n);
+        CHECK(x == a);
+        CHECK(y == b);
+
+        x = a, y = a;
+        CHECK(transform(a, x.begin(), affine).out() == x.end());
+        transform(a, y.begin(), affine, same{});
+        CHECK(x == y);
+        transform(y, y.begin(), affine);
+        transform(x.begin(), x.end(), x.begin(), affine);
+        CHECK(x == y);
+        std::vector<double> d(a.size()), e(a.size());
+        CHECK(transform(static_cast<T const *>(p), p + n, d.data(), half).out() == d.data() + n);
+        transform(a, e.begin(), half, same{});
+        CHECK(d == e);
+
+        x = a, y = a;
+        auto const t = transform(a, b, x.begin(), difference);
+        CHECK(t.in1() == a.end());
+        CHECK(t.in2() == b.end());
+        CHECK(t.out() == x.end());
+        transform(a, b, y.begin(), difference, same{});
+        CHECK(x == y);
+        x = a;
+        CHECK(transform(x.data(), x.data() + n, q, x.data(), difference).out() == x.data() + n);
+        CHECK(x == y);
+        x = a;
+        transform(p, p + n, x.data(), x.data(), difference);
+        transform(a, a, y.begin(), difference, same{});
+        CHECK(x == y);
+    }
+}
+
+int main()
+{
+    using namespace ranges;
+
+    CHECK(active_cpu_isa() <= detected_cpu_isa());
+    if(char const *const env = std::getenv("RANGES_CPU_ISA"))
+    {
+        static char const *const names[] = {"baseline", "sse4.2", "avx2", "avx512"};
+        for(int i = 0; i < 4; ++i)
+            if(std::strcmp(env, names[i]) == 0 && static_cast<cpu_isa>(i) <= detected_cpu_isa())
+                CHECK(active_cpu_isa() == static_cast<cpu_isa>(i));
+    }
+
+    test_type<char>();
+    test_type<signed char>();
+    test_type<unsigned char>();
+    test_type<short>();
+    test_type<std::uint16_t>();
+    test_type<int>();
+    test_type<unsigned>();
+    test_type<std::int64_t>();
+    test_type<std::uint64_t>();
+
+    test_find_first_of<char>();
+    test_find_first_of<signed char>();
+    test_find_first_of<unsigned char>();
+
+    test_mutating<char>();
+    test_mutating<unsigned char>();
+    test_mutating<short>();
+    test_mutating<int>();
+    test_mutating<std::uint64_t>();
+    test_mutating<float>();
+    test_mutating<double>();
+
+    return ::test_result();
+}
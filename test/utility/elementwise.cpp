@@ -0,0 +1,112 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <deque>
+#include <functional>
+#include <list>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/to_container.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/utility/elementwise.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip_with.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct twice
+{
+    double operator()(double x) const
+    {
+        return 2 * x;
+    }
+};
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        template<>
+        struct is_elementwise<::twice> : std::true_type {};
+    }
+}
+
+template<typename Rng>
+constexpr bool flat(Rng const &)
+{
+    return ranges::detail::ElementwiseExpression<Rng>::value;
+}
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<double> a{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    std::vector<double> b{10, 20, 30, 40, 50, 60, 70, 80, 90};
+    std::deque<int> d{1, 2, 3, 4};
+    std::list<int> l{1, 2, 3, 4};
+    auto const square = [](double x) { return x * x; };
+
+    static_assert(is_elementwise<plus>(), "");
+    static_assert(is_elementwise<std::multiplies<double>>(), "");
+    static_assert(is_elementwise<decltype(elementwise(square))>(), "");
+    static_assert(!is_elementwise<decltype(square)>(), "");
+
+    // Pipelines that are evaluated with the flat loop, and their values.
+    {
+        auto e = view::zip_with(plus{}, a, view::transform(b, twice{}));
+        CHECK(flat(e));
+        auto v = to_vector(e);
+        ::check_equal(v, {21, 42, 63, 84, 105, 126, 147, 168, 189});
+
+        auto f = view::transform(view::transform(a, b, std::minus<double>{}),
+            elementwise(square));
+        CHECK(flat(f));
+        auto w = to_vector(f);
+        ::check_equal(w, {81, 324, 729, 1296, 2025, 2916, 3969, 5184, 6561});
+
+        auto g = view::zip_with(std::multiplies<long>{}, view::iota(1, 5), d);
+        CHECK(flat(g));
+        ::check_equal(to_vector(g), {1L, 4L, 9L, 16L});
+
+        // A function that is not elementwise makes its view a leaf, read
+        // through its iterators.
+        auto h = view::zip_with(plus{}, a, view::transform(b, square));
+        CHECK(flat(h));
+        ::check_equal(to_vector(h), {101, 402, 903, 1604, 2505, 3606, 4907, 6408, 8109});
+    }
+
+    // Pipelines that are not.
+    {
+        CHECK(!flat(view::transform(a, square)));
+        CHECK(!flat(view::transform(l, std::negate<int>{})));
+        CHECK(!flat(view::zip_with(plus{}, a, view::iota(0))));
+        ::check_equal(to_vector(view::transform(l, std::negate<int>{})), {-1, -2, -3, -4});
+    }
+
+    // copy into an array returns the ends of the input and the output.
+    {
+        double out[12] = {};
+        auto e = view::transform(a, b, plus{});
+        auto res = copy(e, out);
+        CHECK(res.in() == begin(e) + 9);
+        CHECK(res.out() == out + 9);
+        ::check_equal(out, {11., 22., 33., 44., 55., 66., 77., 88., 99., 0., 0., 0.});
+
+        std::vector<double> v(10);
+        CHECK(copy(view::transform(a, std::negate<double>{}), v.begin()).out() == v.end());
+        CHECK(v.back() == -10);
+    }
+
+    return ::test_result();
+}
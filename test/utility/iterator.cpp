@@ -10,12 +10,18 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <functional>
+#include <list>
 #include <ostream>
 #include <string>
 #include <vector>
 #include <meta/meta.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/merge.hpp>
+#include <range/v3/algorithm/set_algorithm.hpp>
+#include <range/v3/algorithm/transform.hpp>
+#include <range/v3/view/iota.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
@@ -55,6 +61,120 @@ void test_move_iterator()
     ::check_equal(out, {"this","is","his","face"});
 }
 
+template<typename T>
+struct counting_allocator
+{
+    using value_type = T;
+    int *count;
+    explicit counting_allocator(int &c) noexcept
+      : count(&c)
+    {}
+    template<typename U>
+    counting_allocator(counting_allocator<U> const &that) noexcept
+      : count(that.count)
+    {}
+    T *allocate(std::size_t n)
+    {
+        ++*count;
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) noexcept
+    {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+    template<typename U>
+    bool operator==(counting_allocator<U> const &that) const
+    {
+        return count == that.count;
+    }
+    template<typename U>
+    bool operator!=(counting_allocator<U> const &that) const
+    {
+        return count != that.count;
+    }
+};
+
+void test_bulk_insert()
+{
+    int allocs = 0;
+    using V = std::vector<int, counting_allocator<int>>;
+    std::list<int> const l{1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<int> const a{1, 3, 5, 7, 9};
+    std::vector<int> const b{2, 3, 4, 6};
+
+    // A forward range is copied with one range insert.
+    {
+        V v{{0}, counting_allocator<int>{allocs}};
+        allocs = 0;
+        auto res = copy(l, back_inserter(v));
+        CHECK(res.in() == l.end());
+        CHECK(allocs == 1);
+        ::check_equal(v, {0, 1, 2, 3, 4, 5, 6, 7, 8});
+
+        auto out = copy(l.begin(), std::next(l.begin(), 3), inserter(v, v.begin() + 1)).out();
+        ::check_equal(v, {0, 1, 2, 3, 1, 2, 3, 4, 5, 6, 7, 8});
+        *out = 42;
+        ::check_equal(v, {0, 1, 2, 3, 42, 1, 2, 3, 4, 5, 6, 7, 8});
+    }
+
+    // Sized inputs reserve room for their elements.
+    {
+        V v{counting_allocator<int>{allocs}};
+        allocs = 0;
+        copy(view::iota(0, 1000), back_inserter(v));
+        CHECK(allocs == 1);
+        CHECK(v.size() == 1000u);
+        CHECK(v.back() == 999);
+
+        V w{counting_allocator<int>{allocs}};
+        allocs = 0;
+        transform(a, back_inserter(w), std::negate<int>{});
+        CHECK(allocs == 1);
+        ::check_equal(w, {-1, -3, -5, -7, -9});
+        transform(a, b, inserter(w, w.begin() + 1), std::plus<int>{});
+        ::check_equal(w, {-1, 3, 6, 9, 13, -3, -5, -7, -9});
+
+        // Values written in place are kept when the function throws.
+        bool thrown = false;
+        try
+        {
+            transform(a, back_inserter(w), [](int i)
+            {
+                if(i == 5)
+                    throw i;
+                return i;
+            });
+        }
+        catch(int)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+        ::check_equal(w, {-1, 3, 6, 9, 13, -3, -5, -7, -9, 1, 3});
+
+        V m{counting_allocator<int>{allocs}};
+        allocs = 0;
+        merge(a, b, back_inserter(m));
+        CHECK(allocs == 1);
+        ::check_equal(m, {1, 2, 3, 3, 4, 5, 6, 7, 9});
+
+        V u{counting_allocator<int>{allocs}};
+        set_union(a, b, back_inserter(u));
+        ::check_equal(u, {1, 2, 3, 4, 5, 6, 7, 9});
+    }
+
+    // Many short copies through the same iterator still grow geometrically.
+    {
+        V v{counting_allocator<int>{allocs}};
+        allocs = 0;
+        auto out = back_inserter(v);
+        for(int i = 0; i < 1000; ++i)
+            out = copy(view::iota(i, i + 1), out).out();
+        CHECK(v.size() == 1000u);
+        CHECK(allocs < 20);
+    }
+}
+
 template<class I>
 using RI = std::reverse_iterator<I>;
 
@@ -148,6 +268,7 @@ int main()
 {
     test_insert_iterator();
     test_move_iterator();
+    test_bulk_insert();
     issue_420_regression();
 
     {
@@ -0,0 +1,80 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/to_container.hpp>
+#include <range/v3/algorithm/all_of.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/utility/page_allocator.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+
+bool aligned_to(void const *p, std::uintptr_t align)
+{
+    return reinterpret_cast<std::uintptr_t>(p) % align == 0;
+}
+
+int main()
+{
+    using namespace ranges;
+    constexpr int big = 1 << 20;
+
+    // Large blocks are aligned to huge pages where posix_memalign is
+    // available; small blocks are not padded out.
+    {
+        std::vector<int, page_allocator<int>> v(big);
+#if defined(__unix__) || defined(__APPLE__)
+        CHECK(aligned_to(v.data(), 1u << 21));
+#endif
+        CHECK(all_of(v, [](int i) { return i == 0; }));
+        std::vector<char, page_allocator<char>> w(3, 'x');
+        CHECK(aligned_to(w.data(), alignof(void *)));
+        CHECK(w[2] == 'x');
+    }
+
+    // Allocators of any value type compare equal, and rebind keeps the policy.
+    {
+        page_allocator<int, true> a;
+        page_allocator<double, true> b{a};
+        CHECK(a == b);
+        CHECK(!(a != b));
+        using L = std::allocator_traits<page_allocator<int, true>>::rebind_alloc<long>;
+        CONCEPT_ASSERT(Same<L, page_allocator<long, true>>());
+        std::list<int, page_allocator<int>> l{1, 2, 3};
+        CHECK(l.size() == 3u);
+    }
+
+    // First touch happens before construction, so it does not disturb values.
+    {
+        std::vector<double, page_allocator<double, true>> v(big, 1.5);
+        CHECK(all_of(v, [](double d) { return d == 1.5; }));
+        auto w = view::iota(0, big) | to_<std::vector<int, page_allocator<int, true>>>();
+        CHECK(static_cast<int>(w.size()) == big);
+        CHECK(equal(w, view::iota(0, big)));
+    }
+
+    // The algorithms' temporary buffers come from the same layer.
+    {
+        auto v = view::iota(0, big) | view::transform([](int i) { return (i * 7919) % 1000; })
+            | to_vector;
+        stable_sort(v);
+        CHECK(is_sorted(v));
+    }
+
+    return ::test_result();
+}
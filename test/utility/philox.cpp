@@ -0,0 +1,126 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/generate.hpp>
+#include <range/v3/algorithm/generate_n.hpp>
+#include <range/v3/utility/philox.hpp>
+#include <range/v3/utility/random.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+CONCEPT_ASSERT(UniformRandomNumberGenerator<philox4x32>());
+
+std::array<std::uint32_t, 4> next4(philox4x32 &e)
+{
+    std::array<std::uint32_t, 4> a;
+    for(auto &x : a)
+        x = e();
+    return a;
+}
+
+void test_engine()
+{
+    using A = std::array<std::uint32_t, 4>;
+    // Known answers from the Random123 distribution.
+    CHECK((philox4x32::block(A{{0, 0, 0, 0}}, {{0, 0}}) ==
+        A{{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}}));
+    CHECK((philox4x32::block(A{{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+        {{0xffffffff, 0xffffffff}}) ==
+        A{{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}}));
+    CHECK((philox4x32::block(A{{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}},
+        {{0xa4093822, 0x299f31d0}}) ==
+        A{{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}}));
+
+    // The seed is the key; the stream and the block number are the counter.
+    philox4x32 e{0x299f31d0a4093822ull, 0x0370734413198a2eull};
+    for(int i = 0; i < 4; ++i)
+        e.discard(0x85a308d3243f6a88ull);
+    CHECK((next4(e) == A{{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}}));
+    philox4x32 z;
+    CHECK((next4(z) == A{{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}}));
+
+    // discard jumps to where calling the engine would have got to.
+    for(unsigned long long skip : {0, 1, 3, 4, 5, 7, 8, 100, 1001})
+    {
+        for(int start = 0; start < 5; ++start)
+        {
+            philox4x32 a{42, 7}, b{42, 7};
+            for(int i = 0; i < start; ++i)
+            {
+                a();
+                b();
+            }
+            for(unsigned long long i = 0; i < skip; ++i)
+                a();
+            b.discard(skip);
+            CHECK(a == b);
+            CHECK(a() == b());
+        }
+    }
+
+    // Streams and seeds give different sequences; seed() restarts.
+    philox4x32 s0{1, 0}, s1{1, 1}, t0{2, 0};
+    auto const first = next4(s0);
+    CHECK(first != next4(s1));
+    CHECK(first != next4(t0));
+    CHECK(s0 != philox4x32(1, 0));
+    s0.seed(1, 0);
+    CHECK(s0 == philox4x32(1, 0));
+    CHECK(first == next4(s0));
+}
+
+void test_generate()
+{
+    std::normal_distribution<double> const normal{0, 1};
+    std::uniform_int_distribution<int> const dice{1, 6};
+
+    // Element i comes from stream i, however the work is split.
+    for(std::size_t n : {0, 1, 1000, 100000})
+    {
+        std::vector<double> v(n);
+        auto res = generate(par, v, normal, 1234);
+        CHECK(res == v.end());
+        bool same = true;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            philox4x32 e{1234, i};
+            auto d = normal;
+            same = same && v[i] == d(e);
+        }
+        CHECK(same);
+
+        std::vector<double> w(n);
+        CHECK(generate_n(par, w.begin(), static_cast<std::ptrdiff_t>(n), normal, 1234) == w.end());
+        CHECK(v == w);
+    }
+
+    std::vector<int> a(50000), b(50000);
+    generate(par, a, dice, 1);
+    generate(par, b, dice, 2);
+    CHECK(a != b);
+    CHECK(*std::min_element(a.begin(), a.end()) == 1);
+    CHECK(*std::max_element(a.begin(), a.end()) == 6);
+}
+
+int main()
+{
+    test_engine();
+    test_generate();
+
+    return ::test_result();
+}
@@ -9,8 +9,13 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <list>
 #include <vector>
 #include <range/v3/core.hpp>
+#include <range/v3/span.hpp>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/numeric/accumulate.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/take.hpp>
 #include <range/v3/view/reverse.hpp>
@@ -19,6 +24,21 @@
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
+struct sum_fn
+{
+    int &spans;
+    int operator()(ranges::span<int> s) const
+    {
+        ++spans;
+        return ranges::accumulate(s, 0);
+    }
+    template<typename Rng>
+    int operator()(Rng &rng) const
+    {
+        return ranges::accumulate(rng, 0);
+    }
+};
+
 int main()
 {
     using namespace ranges;
@@ -75,5 +95,62 @@ int main()
         ::check_equal(any_view<int>{vec2}, ten_ints);
     }
 
+    // Type recovery and the contiguous fast path
+    {
+        std::vector<int> vec{begin(ten_ints), end(ten_ints)};
+        any_random_access_view<int&> a{vec};
+        auto s = a.contiguous();
+        CHECK(s.data() == vec.data());
+        CHECK(s.size() == 10);
+        CHECK(a.target<std::vector<int>>() != nullptr);
+        CHECK(a.target<std::vector<int>>()->begin() == vec.begin());
+        CHECK(a.target<std::list<int>>() == nullptr);
+        CHECK(detail::as_const(a).target<std::vector<int>>() != nullptr);
+
+        // Copies erase the same type
+        auto b = a;
+        CHECK(b.contiguous().data() == vec.data());
+        CHECK(b.target<std::vector<int>>() != nullptr);
+
+        std::list<int> lst{begin(ten_ints), end(ten_ints)};
+        any_view<int&> c{lst};
+        CHECK(c.contiguous().data() == nullptr);
+        CHECK(c.target<std::list<int>>() != nullptr);
+
+        // Views are recovered by their own type
+        auto rng = view::ints | view::take(10);
+        any_view<int> d{rng};
+        CHECK(d.contiguous().data() == nullptr);
+        CHECK(d.target<decltype(rng)>() != nullptr);
+
+        // Elements that aren't lvalues of the same type aren't contiguous
+        any_view<int> e{vec};
+        CHECK(e.contiguous().data() == nullptr);
+        any_view<int const&> f{vec};
+        CHECK(f.contiguous().data() == vec.data());
+
+        any_view<int&> empty;
+        CHECK(empty.contiguous().data() == nullptr);
+        CHECK(empty.target<std::vector<int>>() == nullptr);
+
+        int spans = 0;
+        CHECK(unwrap_any(a, sum_fn{spans}) == 45);
+        CHECK(spans == 1);
+        CHECK(unwrap_any(c, sum_fn{spans}) == 45);
+        CHECK(unwrap_any(vec, sum_fn{spans}) == 45);
+        CHECK(spans == 1);
+
+        // count and count_if take the span when there is one
+        auto odd = [](int i) { return i % 2 == 1; };
+        CHECK(count(a, 3) == 1);
+        CHECK(count(c, 3) == 1);
+        CHECK(count(f, 3) == 1);
+        CHECK(count(empty, 3) == 0);
+        CHECK(count_if(a, odd) == 5);
+        CHECK(count_if(c, odd) == 5);
+        CHECK(count_if(f, odd) == 5);
+        CHECK(count_if(empty, odd) == 0);
+    }
+
     return test_result();
 }
@@ -0,0 +1,137 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+// CMake runs this test a second time with RANGES_NO_IO_URING set, to cover
+// the pread fallback.
+
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <unistd.h>
+#include <range/v3/core.hpp>
+#include <range/v3/getlines.hpp>
+#include <range/v3/view/file_blocks.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct temp_file
+{
+    std::string path;
+    explicit temp_file(std::string const &text)
+    {
+        char name[] = "/tmp/range-v3-file_blocks-XXXXXX";
+        int const fd = ::mkstemp(name);
+        CHECK(fd != -1);
+        path = name;
+        CHECK(::write(fd, text.data(), text.size()) == static_cast<ssize_t>(text.size()));
+        ::close(fd);
+    }
+    ~temp_file()
+    {
+        std::remove(path.c_str());
+    }
+};
+
+std::string make_text(std::size_t size)
+{
+    std::string text;
+    for(std::size_t i = 0; text.size() < size; ++i)
+        text += std::string(i % 23, static_cast<char>('a' + i % 26)) + (i % 7 ? "\n" : "\n\n");
+    text.resize(size);
+    return text;
+}
+
+void test_file(std::string const &text, std::size_t block, int depth)
+{
+    using namespace ranges;
+    temp_file file{text};
+
+    auto blocks = view::file_blocks(file.path, block, depth);
+    if(std::getenv("RANGES_NO_IO_URING"))
+        CHECK(!blocks.uses_io_uring());
+    std::string joined;
+    std::size_t count = 0;
+    for(auto it = begin(blocks); it != end(blocks); ++it)
+    {
+        auto const b = *it;
+        joined.append(b.data(), static_cast<std::size_t>(b.size()));
+        ++count;
+        CHECK((static_cast<std::size_t>(b.size()) == block || joined.size() == text.size()));
+    }
+    CHECK(joined == text);
+    CHECK(count == (text.size() + block - 1) / block);
+
+    std::vector<std::string> expected;
+    std::istringstream sin{text};
+    RANGES_FOR(auto const &line, getlines(sin))
+        expected.push_back(line);
+    std::vector<std::string> lines;
+    auto rng = view::file_lines(file.path, block, depth);
+    for(auto it = begin(rng); it != end(rng); ++it)
+        lines.emplace_back((*it).data(), static_cast<std::size_t>((*it).size()));
+    CHECK(lines == expected);
+}
+
+int main()
+{
+    using namespace ranges;
+
+    for(std::size_t size : {0, 1, 100, 4096, 4097, 12288, 100000})
+        for(std::size_t block : {1, 7, 4096})
+            for(int depth : {1, 2, 4})
+                if(size / block < 20000)
+                    test_file(make_text(size), block, depth);
+
+    // No trailing newline, and empty lines.
+    test_file("a\n\nbc", 2, 2);
+    test_file("\n\n\n", 1, 3);
+
+    // Blocks join into the characters of the file, and lines feed other
+    // views.
+    {
+        std::string const text = make_text(50000);
+        temp_file file{text};
+        auto chars = view::file_blocks(file.path, 1000) | view::join;
+        std::string s;
+        for(auto it = begin(chars); it != end(chars); ++it)
+            s += *it;
+        CHECK(s == text);
+
+        auto lengths = view::file_lines(file.path, 1000) |
+            view::transform([](span<char const> line) { return line.size(); });
+        std::ptrdiff_t total = 0, n = 0;
+        for(auto it = begin(lengths); it != end(lengths); ++it, ++n)
+            total += *it;
+        CHECK(text.back() != '\n');
+        CHECK(static_cast<std::size_t>(total + n - 1) == text.size());
+    }
+
+    // A file that cannot be opened.
+    {
+        bool thrown = false;
+        try
+        {
+            view::file_blocks("/nonexistent/range-v3/file");
+        }
+        catch(std::system_error const &e)
+        {
+            thrown = e.code() == std::errc::no_such_file_or_directory;
+        }
+        CHECK(thrown);
+    }
+
+    return ::test_result();
+}
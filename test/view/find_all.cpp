@@ -0,0 +1,131 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/getlines.hpp>
+#include <range/v3/view/find_all.hpp>
+#include <range/v3/view/join.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using match = std::pair<std::size_t, std::ptrdiff_t>;
+
+template<typename Text, typename Pats>
+std::vector<match> naive_find_all(Text const &text, Pats const &pats)
+{
+    std::vector<match> res;
+    auto const n = static_cast<std::ptrdiff_t>(text.size());
+    for(std::size_t id = 0; id < pats.size(); ++id)
+    {
+        auto const m = static_cast<std::ptrdiff_t>(pats[id].size());
+        for(std::ptrdiff_t pos = 0; m != 0 && pos + m <= n; ++pos)
+            if(std::equal(pats[id].begin(), pats[id].end(), text.begin() + pos))
+                res.emplace_back(id, pos);
+    }
+    std::sort(res.begin(), res.end());
+    return res;
+}
+
+template<typename Rng>
+std::vector<match> sorted(Rng &&rng)
+{
+    std::vector<match> res;
+    for(auto it = ranges::begin(rng), e = ranges::end(rng); it != e; ++it)
+        res.emplace_back((*it).first, static_cast<std::ptrdiff_t>((*it).second));
+    std::sort(res.begin(), res.end());
+    return res;
+}
+
+int main()
+{
+    using namespace ranges;
+
+    // The classic example: matches are ordered by where they end, longest
+    // first.
+    {
+        std::string text = "ushers";
+        std::vector<std::string> pats{"he", "she", "his", "hers"};
+        auto rng = view::find_all(text, pats);
+        ::models<concepts::ForwardRange>(rng);
+        ::models_not<concepts::SizedRange>(rng);
+        ::check_equal(rng, {match{1, 1}, match{0, 2}, match{3, 2}});
+        ::check_equal(text | view::find_all(pats), {match{1, 1}, match{0, 2}, match{3, 2}});
+    }
+
+    // Overlapping, repeated, duplicate and empty patterns.
+    {
+        std::string text = "aaaa";
+        std::vector<std::string> pats{"aa", "", "a", "aa"};
+        CHECK(sorted(view::find_all(text, pats)) == naive_find_all(text, pats));
+        CHECK(distance(view::find_all(text, pats)) == 10);
+        std::string empty;
+        CHECK(distance(view::find_all(empty, pats)) == 0);
+        CHECK(distance(view::find_all(text, std::vector<std::string>{})) == 0);
+    }
+
+    // Random texts over a small alphabet, against a naive search.
+    {
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<int> sym(0, 3), len(1, 6);
+        auto random_string = [&](int n)
+        {
+            std::string s;
+            for(int i = 0; i < n; ++i)
+                s.push_back(static_cast<char>('a' + sym(gen)));
+            return s;
+        };
+        for(int round = 0; round < 20; ++round)
+        {
+            std::string text = random_string(500);
+            std::vector<std::string> pats;
+            for(int i = 0; i < 30; ++i)
+                pats.push_back(random_string(len(gen)));
+            CHECK(sorted(view::find_all(text, pats)) == naive_find_all(text, pats));
+        }
+    }
+
+    // Wide symbols use the compressed table.
+    {
+        std::vector<int> text{1000, 7, 1000, 7, 1000, -3};
+        std::vector<std::vector<int>> pats{{7, 1000}, {1000, 7, 1000}, {-3}};
+        CHECK(sorted(view::find_all(text, pats)) == naive_find_all(text, pats));
+        std::u32string wtext = U"中文中文";
+        std::vector<std::u32string> wpats{U"文中", U"文"};
+        ::check_equal(view::find_all(wtext, wpats), {match{1, 1}, match{0, 1}, match{1, 3}});
+    }
+
+    // Input ranges are read once.
+    {
+        std::istringstream sin{"one two three two one"};
+        sin >> std::noskipws;
+        std::vector<std::string> pats{"two", "one", "o t"};
+        auto rng = view::find_all(istream<char>(sin), pats);
+        ::models<concepts::InputRange>(rng);
+        ::models_not<concepts::ForwardRange>(rng);
+        ::check_equal(rng, {match{1, 0}, match{0, 4}, match{2, 6}, match{0, 14}, match{1, 18}});
+    }
+    {
+        std::istringstream sin{"error: disk\nok\nwarning: disk error\n"};
+        std::vector<std::string> pats{"error", "disk"};
+        auto lines = getlines(sin);
+        ::check_equal(view::find_all(lines | view::join, pats),
+            {match{0, 0}, match{1, 7}, match{1, 22}, match{0, 27}});
+    }
+
+    return ::test_result();
+}
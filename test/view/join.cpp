@@ -13,6 +13,7 @@
 #include <iterator>
 #include <functional>
 #include <range/v3/core.hpp>
+#include <range/v3/view/filter.hpp>
 #include <range/v3/view/join.hpp>
 #include <range/v3/view/split.hpp>
 #include <range/v3/view/generate_n.hpp>
@@ -115,11 +116,22 @@ int main()
     CHECK(to_<std::string>(rng3) == "Thisishisface");
 
     auto rng4 = view::join(vs, ' ');
-    static_assert(range_cardinality<decltype(rng3)>::value == ranges::finite, "");
+    static_assert(range_cardinality<decltype(rng4)>::value == ranges::finite, "");
     models_not<concepts::SizedRange>(rng4);
     CONCEPT_ASSERT(!SizedSentinel<decltype(end(rng4)), decltype(begin(rng4))>());
     CHECK(to_<std::string>(rng4) == "This is his face");
 
+    std::string sep = ", ";
+    auto rng4b = view::join(vs, sep);
+    models_not<concepts::SizedRange>(rng4b);
+    CHECK(to_<std::string>(rng4b) == "This, is, his, face");
+
+    // An outer range that cannot be iterated when const.
+    auto rng4c = vs | view::filter([](std::string const &s) { return s.size() > 2; }) |
+        view::join;
+    models_not<concepts::SizedRange>(rng4c);
+    CHECK(to_<std::string>(rng4c) == "Thishisface");
+
     auto rng5 = view::join(twice(twice(42)));
     static_assert(range_cardinality<decltype(rng5)>::value == 4, "");
     models<concepts::SizedRange>(rng5);
@@ -132,6 +144,11 @@ int main()
     CHECK(rng6.size() == 4u);
     check_equal(rng6, {42,42,42,42});
 
+    auto rng7 = view::join(twice(view::repeat_n(42, 2)), view::repeat_n(0, 1));
+    models<concepts::SizedRange>(rng7);
+    CHECK(rng7.size() == 5u);
+    check_equal(rng7, {42,42,0,42,42});
+
     test_issue_283();
 
     {
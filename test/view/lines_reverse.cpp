@@ -0,0 +1,98 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/to_container.hpp>
+#include <range/v3/range_for.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/lines_reverse.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+struct as_string
+{
+    template<typename Rng>
+    std::string operator()(Rng const &rng) const
+    {
+        return to_<std::string>(rng);
+    }
+};
+
+template<typename Rng>
+std::vector<std::string> lines_of(Rng const &rng)
+{
+    return view::lines_reverse(rng) | view::transform(as_string{}) | to_vector;
+}
+
+int main()
+{
+    std::string text = "Now is\nthe time\nfor all\ngood men\n";
+    auto rng = view::lines_reverse(text);
+    ::models<concepts::BidirectionalView>(rng);
+    ::models_not<concepts::RandomAccessView>(rng);
+    ::models_not<concepts::SizedView>(rng);
+    CHECK(lines_of(text) == (std::vector<std::string>{"good men", "for all", "the time", "Now is"}));
+    ::check_equal(rng | view::reverse | view::transform(as_string{}),
+        {"Now is", "the time", "for all", "good men"});
+
+    // Walking backward visits the lines in source order.
+    {
+        auto it = end(rng);
+        CHECK(to_<std::string>(*--it) == "Now is");
+        CHECK(to_<std::string>(*--it) == "the time");
+        CHECK(to_<std::string>(*--it) == "for all");
+        CHECK(to_<std::string>(*--it) == "good men");
+        CHECK(it == begin(rng));
+    }
+
+    // Empty lines, and sources with no trailing newline.
+    CHECK(lines_of(std::string{""}).empty());
+    CHECK(lines_of(std::string{"\n"}) == (std::vector<std::string>{""}));
+    CHECK(lines_of(std::string{"a"}) == (std::vector<std::string>{"a"}));
+    CHECK(lines_of(std::string{"a\n\nb"}) == (std::vector<std::string>{"b", "", "a"}));
+    CHECK(lines_of(std::string{"\n\na\n\n"}) == (std::vector<std::string>{"", "a", "", ""}));
+
+    // A region of memory, as from a mapped file, scans with memrchr.
+    {
+        char const *p = text.data();
+        auto region = make_iterator_range(p, p + text.size());
+        CHECK(lines_of(region) == lines_of(text));
+        std::list<char> l(text.begin(), text.end());
+        CHECK(lines_of(l) == lines_of(text));
+    }
+
+    // The last few matching lines.
+    {
+        std::string log;
+        for(int i = 0; i < 1000; ++i)
+            log += (i % 7 == 0 ? "error " : "info ") + std::to_string(i) + "\n";
+        auto last_errors = view::lines_reverse(log)
+            | view::filter([](iterator_range<std::string::iterator> line)
+              {
+                  return as_string{}(line).compare(0, 5, "error") == 0;
+              })
+            | view::take(3);
+        std::vector<std::string> res;
+        RANGES_FOR(auto line, last_errors)
+            res.push_back(as_string{}(line));
+        CHECK(res == (std::vector<std::string>{"error 994", "error 987", "error 980"}));
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,91 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/rle_decode.hpp>
+#include <range/v3/view/rle_encode.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+    using P = std::pair<char, int>;
+
+    std::vector<P> runs = {{'a', 3}, {'b', 0}, {'c', 1}, {'d', 2}};
+
+    {
+        auto rng = runs | view::rle_decode;
+        CONCEPT_ASSERT(RandomAccessRange<decltype(rng)>());
+        CONCEPT_ASSERT(SizedRange<decltype(rng)>());
+        CONCEPT_ASSERT(Same<range_reference_t<decltype(rng)>, char &>());
+        CHECK(rng.size() == 6u);
+        CHECK(rng.runs() == 4u);
+        ::check_equal(rng, {'a', 'a', 'a', 'c', 'd', 'd'});
+        ::check_equal(rng | view::reverse, {'d', 'd', 'c', 'a', 'a', 'a'});
+        CHECK(rng[0] == 'a');
+        CHECK(rng[3] == 'c');
+        CHECK(rng[5] == 'd');
+        CHECK(*(begin(rng) + 4) == 'd');
+        CHECK(*(end(rng) - 4) == 'a');
+        CHECK((end(rng) - begin(rng)) == 6);
+
+        // Writes go to the run's value
+        rng[4] = 'e';
+        CHECK(runs[3].first == 'e');
+    }
+
+    {
+        std::list<P> l(runs.begin(), runs.end());
+        auto rng = view::rle_decode(l);
+        CONCEPT_ASSERT(BidirectionalRange<decltype(rng)>());
+        CONCEPT_ASSERT(!RandomAccessRange<decltype(rng)>());
+        CONCEPT_ASSERT(SizedRange<decltype(rng)>());
+        CHECK(size(rng) == 6u);
+        ::check_equal(rng, {'a', 'a', 'a', 'c', 'e', 'e'});
+
+        std::vector<P> none = {{'x', 0}, {'y', 0}};
+        CHECK(empty(none | view::rle_decode));
+        std::vector<P> nothing;
+        CHECK(size(nothing | view::rle_decode) == 0u);
+    }
+
+    // Copies share the table, and iterators survive moving the view.
+    {
+        auto rng = runs | view::rle_decode;
+        auto it = begin(rng) + 3;
+        auto copy = rng;
+        auto moved = std::move(rng);
+        CHECK(*it == 'c');
+        CHECK(*(it + 2) == 'e');
+        CHECK((end(moved) - it) == 3);
+        ::check_equal(copy, {'a', 'a', 'a', 'c', 'e', 'e'});
+    }
+
+    // Round trip
+    {
+        std::string const str = "aaabccddddde";
+        auto enc = str | view::rle_encode;
+        auto dec = enc | view::rle_decode;
+        CONCEPT_ASSERT(ForwardRange<decltype(dec)>());
+        CONCEPT_ASSERT(SizedRange<decltype(dec)>());
+        CONCEPT_ASSERT(Same<range_reference_t<decltype(dec)>, char>());
+        CHECK(dec.size() == str.size());
+        ::check_equal(dec, str);
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,78 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/counted.hpp>
+#include <range/v3/view/rle_encode.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+int main()
+{
+    using namespace ranges;
+    using P = std::pair<int, std::ptrdiff_t>;
+
+    std::vector<int> v = {1, 1, 1, 2, 3, 3, 1, 1};
+
+    {
+        auto rng = v | view::rle_encode;
+        CONCEPT_ASSERT(ForwardRange<decltype(rng)>());
+        CONCEPT_ASSERT(!BidirectionalRange<decltype(rng)>());
+        CONCEPT_ASSERT(Same<range_value_t<decltype(rng)>, P>());
+        ::check_equal(rng, {P{1, 3}, P{2, 1}, P{3, 2}, P{1, 2}});
+
+        std::vector<int> empty;
+        CHECK(begin(empty | view::rle_encode) == end(empty | view::rle_encode));
+    }
+
+    // Not contiguous
+    {
+        std::list<int> l(v.begin(), v.end());
+        ::check_equal(view::rle_encode(l), {P{1, 3}, P{2, 1}, P{3, 2}, P{1, 2}});
+
+        forward_iterator<std::vector<int>::iterator> b{v.begin()};
+        ::check_equal(view::counted(b, v.size()) | view::rle_encode,
+            {P{1, 3}, P{2, 1}, P{3, 2}, P{1, 2}});
+    }
+
+    // Runs longer than the vectorized block, ending at every offset
+    {
+        bool ok = true;
+        for(int n = 1; n < 100; ++n)
+        {
+            std::vector<double> d(n, 0.5);
+            d.push_back(1.5);
+            d.push_back(1.5);
+            auto rng = d | view::rle_encode;
+            auto it = begin(rng);
+            ok = ok && (*it).second == n && (*++it).second == 2 && ++it == end(rng);
+        }
+        CHECK(ok);
+    }
+
+    // With a projection; the first element of each run is reported.
+    {
+        std::vector<std::string> words = {"apple", "avocado", "banana", "blueberry", "cherry"};
+        using Q = std::pair<std::string, std::ptrdiff_t>;
+        ::check_equal(words | view::rle_encode([](std::string const &s) { return s[0]; }),
+            {Q{"apple", 2}, Q{"banana", 2}, Q{"cherry", 1}});
+    }
+
+    return ::test_result();
+}
@@ -1,5 +1,8 @@
 #include <range/v3/view/sample.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/algorithm/adjacent_find.hpp>
 #include <range/v3/algorithm/equal.hpp>
+#include <range/v3/to_container.hpp>
 #include <numeric>
 #include <vector>
 #include <random>
@@ -27,5 +30,25 @@ int main ()
         CHECK(ranges::equal(rng, tmp));
     }
 
+    // A small sample of a random-access range is picked by position.
+    {
+        std::vector<int> big(10000);
+        std::iota(std::begin(big), std::end(big), 0);
+        std::mt19937 engine;
+        auto v = big | view::sample(10, engine) | to_vector;
+        CHECK(v.size() == 10u);
+        CHECK(adjacent_find(v, [](int a, int b) { return a >= b; }) == v.end());
+
+        std::vector<int> hits(20);
+        for(int i = 0; i < 4000; ++i)
+            for(int j : view::take(pop, 20) | view::sample(2, engine) | to_vector)
+                ++hits[static_cast<std::size_t>(j)];
+        for(int h : hits)
+        {
+            CHECK(h > 300);
+            CHECK(h < 500);
+        }
+    }
+
     return ::test_result();
 }
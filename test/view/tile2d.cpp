@@ -0,0 +1,112 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/tile2d.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    // A 3x4 matrix, stored row-major:
+    //   0  1  2  3
+    //   4  5  6  7
+    //   8  9 10 11
+    std::vector<int> v = view::iota(0,12);
+
+    auto rows = v | view::rows(4);
+    ::models<concepts::RandomAccessView>(rows);
+    ::models<concepts::SizedRange>(rows);
+    ::models<concepts::BoundedRange>(rows);
+    CHECK(size(rows) == 3u);
+    ::check_equal(rows[0], {0,1,2,3});
+    ::check_equal(rows[2], {8,9,10,11});
+    ::check_equal(*(end(rows) - 2), {4,5,6,7});
+    static_assert(Same<range_value_t<decltype(rows)>, span<int>>(), "");
+
+    auto cols = view::cols(v, 4);
+    ::models<concepts::RandomAccessView>(cols);
+    ::models<concepts::SizedRange>(cols);
+    CHECK(size(cols) == 4u);
+    ::check_equal(cols[0], {0,4,8});
+    ::check_equal(cols[3], {3,7,11});
+    ::models<concepts::RandomAccessRange>(cols[1]);
+    ::models<concepts::SizedRange>(cols[1]);
+    CHECK(cols[1][2] == 9);
+    CHECK((end(cols[1]) - begin(cols[1])) == 3);
+
+    // Columns are writable
+    cols[2][1] = 42;
+    CHECK(v[6] == 42);
+    v[6] = 6;
+
+    auto tiles = v | view::tile2d(4, 2, 3);
+    ::models<concepts::RandomAccessView>(tiles);
+    ::models<concepts::SizedRange>(tiles);
+    CHECK(size(tiles) == 4u);
+    CHECK(tiles.tiles_down() == 2);
+    CHECK(tiles.tiles_across() == 2);
+    ::check_equal(tiles[0][0], {0,1,2});
+    ::check_equal(tiles[0][1], {4,5,6});
+    ::check_equal(tiles[1][0], {3});
+    ::check_equal(tiles[1][1], {7});
+    CHECK(size(tiles[2]) == 1u);
+    ::check_equal(tiles[2][0], {8,9,10});
+    ::check_equal(tiles[3][0], {11});
+    CHECK(tiles[3].pitch() == 4);
+
+    // Columns of a tile
+    ::check_equal(view::cols(tiles[0])[1], {1,5});
+    ::check_equal((tiles[1] | view::cols)[0], {3,7});
+
+    // Tiles of a tile
+    auto sub = view::tile2d(tiles[0], 1, 2);
+    CHECK(size(sub) == 4u);
+    ::check_equal(sub[1][0], {2});
+    ::check_equal(sub[2][0], {4,5});
+
+    // Const storage
+    std::vector<int> const &cv = v;
+    auto crows = view::rows(cv, 6);
+    static_assert(Same<range_value_t<decltype(crows)>, span<int const>>(), "");
+    CHECK(size(crows) == 2u);
+    ::check_equal(crows[1], {6,7,8,9,10,11});
+
+    // Iterators don't point into the view, so they survive moving it
+    auto it = begin(tiles) + 2;
+    {
+        auto moved = std::move(tiles);
+        tiles = view::tile2d(v, 12, 1, 1);
+        ::check_equal((*it)[0], {8,9,10});
+        ::check_equal((*(begin(moved) + 3))[0], {11});
+    }
+    ::check_equal((*it)[0], {8,9,10});
+
+    // Temporary containers would dangle
+    CONCEPT_ASSERT(Invocable<view::rows_fn const &, std::vector<int> &, std::ptrdiff_t>());
+    CONCEPT_ASSERT(!Invocable<view::rows_fn const &, std::vector<int>, std::ptrdiff_t>());
+    CONCEPT_ASSERT(!Invocable<view::cols_fn const &, std::vector<int>, std::ptrdiff_t>());
+    CONCEPT_ASSERT(!Invocable<view::tile2d_fn const &, std::vector<int>, std::ptrdiff_t,
+        std::ptrdiff_t, std::ptrdiff_t>());
+    CONCEPT_ASSERT(Invocable<view::rows_fn const &, span<int>, std::ptrdiff_t>());
+
+    // Empty matrix
+    std::vector<int> e;
+    CHECK(size(view::rows(e, 3)) == 0u);
+    CHECK(size(view::cols(e, 3)) == 0u);
+    CHECK(size(view::tile2d(e, 3, 2, 2)) == 0u);
+
+    return ::test_result();
+}